@@ -81,12 +81,6 @@ namespace my_namespace { namespace detail {
     files. Documentation for `type_index_facade` could be also useful.
 */
 
-/*`
-    Since we are not going to override `type_index_facade::hash_code()` we must additionally include
-    `<boost/container_hash/hash.hpp>`.
-*/
-#include <boost/container_hash/hash.hpp>
-
 /*`
     See implementation of `my_type_index`:
 */
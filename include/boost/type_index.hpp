@@ -192,6 +192,57 @@ typedef type_index::type_info_t type_info;
 /// section of documentation for more info.
 #define BOOST_TYPE_INDEX_FORCE_NO_RTTI_COMPATIBILITY
 
+/// \def BOOST_TYPE_INDEX_STL_CACHE_HASH
+/// BOOST_TYPE_INDEX_STL_CACHE_HASH is a helper macro that makes boost::typeindex::stl_type_index::hash_code()
+/// compute the std::type_info::hash_code() only once per type and take it from a process wide lock-free cache afterwards.
+///
+/// Useful for Standard Libraries that hash the whole mangled type name on each std::type_info::hash_code() call,
+/// if the type names are long and hashes are computed often.
+#define BOOST_TYPE_INDEX_STL_CACHE_HASH
+
+/// \def BOOST_TYPE_INDEX_STL_NO_BUILTIN_DEMANGLER
+/// BOOST_TYPE_INDEX_STL_NO_BUILTIN_DEMANGLER is a helper macro that makes boost::typeindex::stl_type_index
+/// demangle the names only with boost::core::demangle().
+///
+/// By default with libstdc++ the names are demangled by the boost::typeindex::demangle_type_name() that does not
+/// allocate memory, but its header noticeably increases the compilation time of each translation unit that
+/// includes boost/type_index/stl_type_index.hpp. The names are the same in both modes. The header is not included
+/// with other Standard Libraries.
+#define BOOST_TYPE_INDEX_STL_NO_BUILTIN_DEMANGLER
+
+/// \def BOOST_TYPE_INDEX_CTTI_UNTRIMMED_NAMES
+/// BOOST_TYPE_INDEX_CTTI_UNTRIMMED_NAMES is a helper macro that disables computing the names of
+/// boost::typeindex::ctti_type_index at compile time.
+///
+/// By default on C++14 compilers the name of a type is trimmed from the function signature at compile time.
+/// That results in a smaller binary, but takes more time and memory to compile. With the macro defined
+/// some compilers keep the whole function signature in the binary. BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES is ignored.
+///
+/// See the `ctti_size_report` test for the numbers on your platform.
+#define BOOST_TYPE_INDEX_CTTI_UNTRIMMED_NAMES
+
+/// \def BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES
+/// BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES is a helper macro that makes boost::typeindex::ctti_type_index compute
+/// the compact, short and normalized names at compile time.
+///
+/// By default those names are computed at runtime on the first use for each type and are kept in a process wide
+/// cache till the program ends. With the macro defined all the names of a type are packed into a single array per
+/// type, sharing the common endings, and the `*_name_view()` functions and normalized_fingerprint() are constexpr.
+/// The compilation takes about 3 times more time, see the `ctti_compile_benchmark` test.
+#define BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES
+
+/// \def BOOST_TYPE_INDEX_RUNTIME_CAST_BASE_TABLE
+/// BOOST_TYPE_INDEX_RUNTIME_CAST_BASE_TABLE is a helper macro that makes BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST and
+/// BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS emit a compile time table of all the bases of the class. boost::typeindex::runtime_cast
+/// consults the table first: it does a linear search over the ctti_type_index::fingerprint() values of the bases and
+/// adjusts the pointer with a function from the table.
+///
+/// Bases that are reachable only through virtual bases and the ambiguous bases have no function in the table. For them
+/// the cast falls back to the search through the bases with the process wide cache of the results, as without the macro.
+/// The macro requires C++14 constexpr and is ignored otherwise. It changes the layout of the classes, so it must be
+/// defined in the same way in all the translation units of the program.
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_BASE_TABLE
+
 #endif // defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
 
 
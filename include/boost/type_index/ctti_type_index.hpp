@@ -21,8 +21,21 @@
 #include <boost/type_index/type_index_facade.hpp>
 #include <boost/type_index/detail/compile_time_type_info.hpp>
 
+#if !defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+#include <boost/type_index/detail/stl_type_info_cache.hpp>
+#include <boost/throw_exception.hpp>
+#include <new>
+#include <string>
+#include <utility>
+#endif
+
 #include <cstring>
+#include <cstdint>
 #include <type_traits>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
 #include <boost/container_hash/hash.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -62,6 +75,30 @@ public:
     ctti_data& operator=(const ctti_data&) = delete;
 };
 
+#if !defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+/// Names that are not computed at compile time, kept in the process wide cache that is keyed by the ctti_entry address
+struct ctti_compact_names {
+    std::string     compact_name;           // never modified after construction, so its data() is stable
+    std::string     short_name;             // never modified after construction, so its data() is stable
+    std::string     normalized_name;        // never modified after construction, so its data() is stable
+    std::uint64_t   normalized_fingerprint; // hash of the normalized_name
+};
+
+struct ctti_compact_names_factory {
+    ctti_compact_names operator()(const ctti_entry& entry) const {
+        std::string compact_name = boost::typeindex::detail::compact_type_name(std::string(entry.name, entry.size), false);
+        std::string short_name = compact_name;
+        short_name.resize(boost::typeindex::detail::strip_namespaces(&short_name[0], short_name.size()));
+        std::string normalized_name = boost::typeindex::detail::normalize_type_name(compact_name);
+        const std::uint64_t normalized_fingerprint
+            = boost::typeindex::detail::name_hash(normalized_name.data(), normalized_name.size());
+        return ctti_compact_names{
+            std::move(compact_name), std::move(short_name), std::move(normalized_name), normalized_fingerprint
+        };
+    }
+};
+#endif
+
 } // namespace detail
 
 /// Helper method for getting detail::ctti_data of a template parameter T.
@@ -77,7 +114,7 @@ inline const detail::ctti_data& ctti_construct() noexcept {
     // value.
     //
     // Alignments are checked in `type_index_test_ctti_alignment.cpp` test.
-    return *reinterpret_cast<const detail::ctti_data*>(boost::detail::ctti<T>::n());
+    return *reinterpret_cast<const detail::ctti_data*>(detail::ctti_entry_holder<T>::get());
 }
 
 /// \class ctti_type_index
@@ -87,37 +124,64 @@ inline const detail::ctti_data& ctti_construct() noexcept {
 /// This class on C++14 compatible compilers has following functions marked as constexpr:
 ///     * default constructor
 ///     * copy constructors and assignemnt operations
-///     * class methods: name(), before(const ctti_type_index& rhs), equal(const ctti_type_index& rhs)
+///     * class methods: name(), hash_code(), fingerprint(), before(const ctti_type_index& rhs), equal(const ctti_type_index& rhs)
+///     * class methods raw_name_view(), pretty_name_view() if std::string_view is available
+///     * class methods compact_name_view(), short_name_view(), normalized_name_view(), normalized_fingerprint()
+///       if BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES is defined, otherwise they take the names from a process wide cache
 ///     * static methods type_id<T>(), type_id_with_cvr<T>()
 ///     * comparison operators
 ///
 /// This class produces slightly longer type names, so consider using stl_type_index
 /// in situations when typeid() is working.
 class ctti_type_index: public type_index_facade<ctti_type_index, detail::ctti_data> {
-    const char* data_;
-
-    inline std::size_t get_raw_name_length() const noexcept;
+    const detail::ctti_entry* data_;
 
-    BOOST_CXX14_CONSTEXPR inline explicit ctti_type_index(const char* data) noexcept
+    BOOST_CXX14_CONSTEXPR inline explicit ctti_type_index(const detail::ctti_entry* data) noexcept
         : data_(data)
     {}
 
+#if !defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+    inline const detail::ctti_compact_names* cached_compact_names() const;
+#endif
+
 public:
     typedef detail::ctti_data type_info_t;
 
     BOOST_CXX14_CONSTEXPR inline ctti_type_index() noexcept
-        : data_(boost::detail::ctti<void>::n())
+        : data_(detail::ctti_entry_holder<void>::get())
     {}
 
     inline ctti_type_index(const type_info_t& data) noexcept
-        : data_(reinterpret_cast<const char*>(&data))
+        : data_(reinterpret_cast<const detail::ctti_entry*>(&data))
     {}
 
     inline const type_info_t& type_info() const noexcept;
     BOOST_CXX14_CONSTEXPR inline const char* raw_name() const noexcept;
     BOOST_CXX14_CONSTEXPR inline const char* name() const noexcept;
     inline std::string  pretty_name() const;
-    inline std::size_t  hash_code() const noexcept;
+    inline std::string  compact_name() const;
+    inline std::string  short_name() const;
+    inline std::string  normalized_name() const;
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    constexpr inline std::string_view raw_name_view() const noexcept;
+    constexpr inline std::string_view pretty_name_view() const noexcept;
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+    constexpr inline std::string_view compact_name_view() const noexcept;
+    constexpr inline std::string_view short_name_view() const noexcept;
+    constexpr inline std::string_view normalized_name_view() const noexcept;
+#else
+    inline std::string_view compact_name_view() const;
+    inline std::string_view short_name_view() const;
+    inline std::string_view normalized_name_view() const;
+#endif
+#endif
+    BOOST_CXX14_CONSTEXPR inline std::size_t hash_code() const noexcept;
+    BOOST_CXX14_CONSTEXPR inline std::uint64_t fingerprint() const noexcept;
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+    constexpr inline std::uint64_t normalized_fingerprint() const noexcept;
+#else
+    inline std::uint64_t normalized_fingerprint() const;
+#endif
 
     BOOST_CXX14_CONSTEXPR inline bool equal(const ctti_type_index& rhs) const noexcept;
     BOOST_CXX14_CONSTEXPR inline bool before(const ctti_type_index& rhs) const noexcept;
@@ -130,6 +194,14 @@ public:
 
     template <class T>
     inline static ctti_type_index type_id_runtime(const T& variable) noexcept;
+
+#ifndef BOOST_NO_IOSTREAM
+    /// Outputs the pretty_name() right from the read-only section of the binary, without allocating memory.
+    template <class CharT, class TriatT>
+    friend std::basic_ostream<CharT, TriatT>& operator<<(std::basic_ostream<CharT, TriatT>& ostr, const ctti_type_index& ind) {
+        return boost::typeindex::detail::ostream_insert(ostr, ind.data_->name, ind.data_->size);
+    }
+#endif
 };
 
 
@@ -139,15 +211,19 @@ inline const ctti_type_index::type_info_t& ctti_type_index::type_info() const no
 
 
 BOOST_CXX14_CONSTEXPR inline bool ctti_type_index::equal(const ctti_type_index& rhs) const noexcept {
-    const char* const left = raw_name();
-    const char* const right = rhs.raw_name();
-    return /*left == right ||*/ !boost::typeindex::detail::constexpr_strcmp(left, right);
+    // Entries are merged across the modules only for the types with default visibility
+    if (data_ == rhs.data_) {
+        return true;
+    }
+
+    // Different hashes mean different types, names are compared only for the same types from different modules
+    return data_->hash == rhs.data_->hash
+        && !boost::typeindex::detail::constexpr_name_compare(data_->name, data_->size, rhs.data_->name, rhs.data_->size);
 }
 
 BOOST_CXX14_CONSTEXPR inline bool ctti_type_index::before(const ctti_type_index& rhs) const noexcept {
-    const char* const left = raw_name();
-    const char* const right = rhs.raw_name();
-    return /*left != right &&*/ boost::typeindex::detail::constexpr_strcmp(left, right) < 0;
+    return data_ != rhs.data_
+        && boost::typeindex::detail::constexpr_name_compare(data_->name, data_->size, rhs.data_->name, rhs.data_->size) < 0;
 }
 
 
@@ -155,14 +231,14 @@ template <class T>
 BOOST_CXX14_CONSTEXPR inline ctti_type_index ctti_type_index::type_id() noexcept {
     typedef typename std::remove_reference<T>::type no_ref_t;
     typedef typename std::remove_cv<no_ref_t>::type no_cvr_t;
-    return ctti_type_index(boost::detail::ctti<no_cvr_t>::n());
+    return ctti_type_index(detail::ctti_entry_holder<no_cvr_t>::get());
 }
 
 
 
 template <class T>
 BOOST_CXX14_CONSTEXPR inline ctti_type_index ctti_type_index::type_id_with_cvr() noexcept {
-    return ctti_type_index(boost::detail::ctti<T>::n());
+    return ctti_type_index(detail::ctti_entry_holder<T>::get());
 }
 
 
@@ -173,31 +249,139 @@ inline ctti_type_index ctti_type_index::type_id_runtime(const T& variable) noexc
 
 
 BOOST_CXX14_CONSTEXPR inline const char* ctti_type_index::raw_name() const noexcept {
-    return data_;
+    return data_->name;
 }
 
 
 BOOST_CXX14_CONSTEXPR inline const char* ctti_type_index::name() const noexcept {
-    return data_;
+    return data_->name;
 }
 
-inline std::size_t ctti_type_index::get_raw_name_length() const noexcept {
-    return std::strlen(raw_name() + detail::skip().size_at_end);
+inline std::string ctti_type_index::pretty_name() const {
+    // Length of the name is computed only once per type, at compile time if C++14 constexpr is supported
+    return std::string(raw_name(), data_->size);
 }
 
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+inline std::string ctti_type_index::compact_name() const {
+    // Computed at compile time
+    return std::string(data_->name + data_->compact_offset, data_->compact_size);
+}
 
-inline std::string ctti_type_index::pretty_name() const {
-    std::size_t len = get_raw_name_length();
-    while (raw_name()[len - 1] == ' ') --len; // MSVC sometimes adds whitespaces
-    return std::string(raw_name(), len);
+inline std::string ctti_type_index::short_name() const {
+    return std::string(data_->name + data_->short_offset, data_->short_size);
+}
+
+inline std::string ctti_type_index::normalized_name() const {
+    return std::string(data_->name + data_->normalized_offset, data_->normalized_size);
+}
+#else
+inline const detail::ctti_compact_names* ctti_type_index::cached_compact_names() const {
+    // Names are computed once per type, like the names of the stl_type_index
+    const detail::stl_type_info_cache_entry<detail::ctti_entry, detail::ctti_compact_names>* const entry
+        = detail::stl_type_info_cache<detail::ctti_entry, detail::ctti_compact_names>::instance().find(
+            *data_, detail::ctti_compact_names_factory()
+        );
+    return entry ? &entry->value : nullptr;
+}
+
+inline std::string ctti_type_index::compact_name() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    return names ? names->compact_name : detail::ctti_compact_names_factory()(*data_).compact_name;
+}
+
+inline std::string ctti_type_index::short_name() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    return names ? names->short_name : detail::ctti_compact_names_factory()(*data_).short_name;
+}
+
+inline std::string ctti_type_index::normalized_name() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    return names ? names->normalized_name : detail::ctti_compact_names_factory()(*data_).normalized_name;
+}
+#endif
+
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+constexpr inline std::string_view ctti_type_index::raw_name_view() const noexcept {
+    return std::string_view(data_->name);
+}
+
+
+constexpr inline std::string_view ctti_type_index::pretty_name_view() const noexcept {
+    // Pretty name is a part of the raw name, that is stored in the read-only section of the binary
+    return std::string_view(data_->name, data_->size);
+}
+
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+constexpr inline std::string_view ctti_type_index::compact_name_view() const noexcept {
+    return std::string_view(data_->name + data_->compact_offset, data_->compact_size);
 }
 
 
-inline std::size_t ctti_type_index::hash_code() const noexcept {
-    return boost::hash_range(raw_name(), raw_name() + get_raw_name_length());
+constexpr inline std::string_view ctti_type_index::short_name_view() const noexcept {
+    return std::string_view(data_->name + data_->short_offset, data_->short_size);
 }
 
 
+constexpr inline std::string_view ctti_type_index::normalized_name_view() const noexcept {
+    return std::string_view(data_->name + data_->normalized_offset, data_->normalized_size);
+}
+#else
+inline std::string_view ctti_type_index::compact_name_view() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    if (!names) {
+        // There's no storage for the name that outlives this call
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->compact_name);
+}
+
+
+inline std::string_view ctti_type_index::short_name_view() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    if (!names) {
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->short_name);
+}
+
+
+inline std::string_view ctti_type_index::normalized_name_view() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    if (!names) {
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->normalized_name);
+}
+#endif
+#endif
+
+
+BOOST_CXX14_CONSTEXPR inline std::size_t ctti_type_index::hash_code() const noexcept {
+    return static_cast<std::size_t>(data_->hash);
+}
+
+
+BOOST_CXX14_CONSTEXPR inline std::uint64_t ctti_type_index::fingerprint() const noexcept {
+    // pretty_name() is the trimmed name, which hash is already computed
+    return data_->hash;
+}
+
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+constexpr inline std::uint64_t ctti_type_index::normalized_fingerprint() const noexcept {
+    return data_->normalized_hash;
+}
+#else
+inline std::uint64_t ctti_type_index::normalized_fingerprint() const {
+    const detail::ctti_compact_names* const names = cached_compact_names();
+    return names ? names->normalized_fingerprint : detail::ctti_compact_names_factory()(*data_).normalized_fingerprint;
+}
+#endif
+
+
 }} // namespace boost::typeindex
 
 #endif // BOOST_TYPE_INDEX_CTTI_TYPE_INDEX_HPP
@@ -0,0 +1,131 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DEMANGLE_HPP
+#define BOOST_TYPE_INDEX_DEMANGLE_HPP
+
+/// \file demangle.hpp
+/// \brief Contains boost::typeindex::demangle_type_name() function that demangles the
+/// std::type_info::name() without memory allocations and exceptions.
+
+#include <boost/config.hpp>
+#include <boost/type_index/detail/strip_cvr_saver.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+/// @cond
+// Same detection as in boost/core/demangle.hpp: std::type_info::name() returns mangled names
+// on platforms with the Itanium C++ ABI support library.
+#if defined(__has_include) && (!defined(BOOST_GCC) || (__GNUC__ + 0) >= 5)
+# if __has_include(<cxxabi.h>)
+#  define BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES
+# endif
+#elif defined(__GLIBCXX__) || defined(__GLIBCPP__)
+# define BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES
+#endif
+/// @endcond
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES)
+#include <boost/type_index/detail/itanium_demangle.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+/// Result codes of the demangle_type_name().
+enum class demangle_status {
+    success,            ///< Buffer contains the zero terminated demangled name.
+    invalid_name,       ///< Input is not a mangled type name.
+    unsupported,        ///< Input uses constructs that the built-in demangler does not support, boost::core::demangle() could be used for it.
+    too_complex,        ///< Input or output is too big for the internal limits of the demangler.
+    buffer_too_small    ///< Demangled name does not fit into the buffer.
+};
+
+/// Result of the demangle_type_name().
+struct demangle_result {
+    demangle_status status;
+
+    /// Length of the demangled name without the terminating zero if the status is demangle_status::success.
+    /// Size of the buffer that is enough for the demangled name if the status is demangle_status::buffer_too_small.
+    /// Zero otherwise.
+    std::size_t     size;
+};
+
+/// Demangles the type name into the buffer, removing the cvr_saver wrapper just like the
+/// stl_type_index::pretty_name() does.
+///
+/// Unlike boost::core::demangle() this function does not allocate memory and does not throw.
+/// On platforms with the Itanium C++ ABI the built-in demangler supports the subset of the ABI that
+/// is used by the std::type_info::name(): builtin, class, enum, function, array, pointer to member and
+/// qualified types, template arguments that are types or literals, local classes, lambdas and
+/// unnamed types. Output is the same as the output of the libstdc++ __cxa_demangle. Names that
+/// use other constructs produce demangle_status::unsupported. On other platforms the name is already
+/// demangled and it is just copied.
+///
+/// \code
+/// char buffer[256];
+/// const boost::typeindex::demangle_result result = boost::typeindex::demangle_type_name(
+///     typeid(T).name(), buffer, sizeof(buffer)
+/// );
+/// if (result.status == boost::typeindex::demangle_status::success) {
+///     log(buffer, result.size);
+/// }
+/// \endcode
+///
+/// \param name Result of the std::type_info::name().
+/// \param buffer Buffer for the demangled name. On failure its content is unspecified.
+/// \param buffer_size Size of the buffer.
+/// \return Status and size of the result. See demangle_result for more info.
+inline demangle_result demangle_type_name(const char* name, char* buffer, std::size_t buffer_size) noexcept {
+    std::size_t size = 0;
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES)
+    detail::itanium::parser parser(name, name + std::strlen(name));
+    const detail::itanium::node* const type = parser.parse();
+    if (!type) {
+        switch (parser.error()) {
+        case detail::itanium::parse_error::unsupported: return demangle_result{demangle_status::unsupported, 0};
+        case detail::itanium::parse_error::too_complex: return demangle_result{demangle_status::too_complex, 0};
+        default: return demangle_result{demangle_status::invalid_name, 0};
+        }
+    }
+
+    detail::itanium::printer printer(buffer, buffer_size);
+    printer.print(type);
+    if (printer.failed()) {
+        return demangle_result{demangle_status::too_complex, 0};
+    }
+    size = printer.size();
+#else
+    // In case of MSVC std::type_info::name() returns demangled name
+    size = std::strlen(name);
+    std::memcpy(buffer, name, size < buffer_size ? size : buffer_size);
+#endif
+
+    if (size >= buffer_size) {
+        return demangle_result{demangle_status::buffer_too_small, size + 1};
+    }
+    buffer[size] = '\0';
+
+    const char* begin = buffer;
+    const char* end = buffer + size;
+    detail::strip_cvr_saver(begin, end);
+    size = static_cast<std::size_t>(end - begin);
+    std::memmove(buffer, begin, size);
+    buffer[size] = '\0';
+
+    return demangle_result{demangle_status::success, size};
+}
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_DEMANGLE_HPP
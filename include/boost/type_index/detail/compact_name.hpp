@@ -0,0 +1,501 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_COMPACT_NAME_HPP
+#define BOOST_TYPE_INDEX_DETAIL_COMPACT_NAME_HPP
+
+/// \file compact_name.hpp
+/// \brief Contains the algorithm that makes the compact_name() and short_name() from the pretty_name().
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <string>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+    BOOST_CXX14_CONSTEXPR inline bool compact_name_is_ident(char c) noexcept {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    // Compares [begin, end) with the zero terminated literal
+    BOOST_CXX14_CONSTEXPR inline bool compact_name_equal(const char* begin, const char* end, const char* literal) noexcept {
+        for (; begin != end; ++begin, ++literal) {
+            if (*begin != *literal) {
+                return false;
+            }
+        }
+        return *literal == '\0';
+    }
+
+    BOOST_CXX14_CONSTEXPR inline bool compact_name_starts_with(const char* begin, const char* end, const char* literal) noexcept {
+        for (; *literal; ++begin, ++literal) {
+            if (begin == end || *begin != *literal) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    BOOST_CXX14_CONSTEXPR inline std::size_t compact_name_literal_size(const char* literal) noexcept {
+        std::size_t size = 0;
+        while (literal[size]) {
+            ++size;
+        }
+        return size;
+    }
+
+    BOOST_CXX14_CONSTEXPR inline void compact_name_skip_spaces(const char*& begin, const char* end) noexcept {
+        while (begin != end && *begin == ' ') {
+            ++begin;
+        }
+    }
+
+    // MSVC prefixes class names with the kind of the class
+    BOOST_CXX14_CONSTEXPR inline void compact_name_skip_keyword(const char*& begin, const char* end) noexcept {
+        compact_name_skip_spaces(begin, end);
+        if (compact_name_starts_with(begin, end, "class ")) {
+            begin += 6;
+        } else if (compact_name_starts_with(begin, end, "struct ")) {
+            begin += 7;
+        }
+    }
+
+    // Matches the beginning of [begin, end) with [pattern, pattern_end) ignoring the spaces, moves the begin past the match
+    BOOST_CXX14_CONSTEXPR inline bool compact_name_match(const char*& begin, const char* end,
+                                                         const char* pattern, const char* pattern_end) noexcept
+    {
+        const char* it = begin;
+        for (;;) {
+            compact_name_skip_spaces(pattern, pattern_end);
+            if (pattern == pattern_end) {
+                begin = it;
+                return true;
+            }
+            compact_name_skip_spaces(it, end);
+            if (it == end || *it != *pattern) {
+                return false;
+            }
+            ++it;
+            ++pattern;
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR inline bool compact_name_match(const char*& begin, const char* end, const char* literal) noexcept {
+        return detail::compact_name_match(begin, end, literal, literal + detail::compact_name_literal_size(literal));
+    }
+
+    // Writes the compact name into the buffer. Output is never longer than the input.
+    class compact_name_builder {
+    public:
+        BOOST_CXX14_CONSTEXPR compact_name_builder(const char* begin, const char* end, char* out) noexcept
+            : in_(begin)
+            , end_(end)
+            , out_(out)
+            , capacity_(static_cast<std::size_t>(end - begin))
+            , pos_(0)
+            , failed_(false)
+        {}
+
+        // Returns false if the name has unbalanced brackets
+        BOOST_CXX14_CONSTEXPR bool build() noexcept {
+            sequence('\0');
+            return !failed_ && in_ == end_;
+        }
+
+        BOOST_CXX14_CONSTEXPR std::size_t size() const noexcept {
+            return pos_;
+        }
+
+    private:
+        static constexpr std::size_t max_args = 8;
+
+        BOOST_CXX14_CONSTEXPR void put(char c) noexcept {
+            if (pos_ == capacity_) {
+                failed_ = true;
+                return;
+            }
+            out_[pos_++] = c;
+        }
+
+        // Copies the input till the `close` character. For '>' stops also on the ',' that separates template arguments.
+        BOOST_CXX14_CONSTEXPR void sequence(char close) noexcept {
+            std::size_t name_start = pos_;  // beginning of the last qualified name in the output
+            while (in_ != end_ && !failed_) {
+                const char c = *in_;
+                if (c == close || (close == '>' && c == ',')) {
+                    return;
+                }
+
+                if (c == '<') {
+                    template_args(name_start);
+                } else if (c == '(' || c == '[' || c == '{') {
+                    put(c);
+                    ++in_;
+                    sequence(c == '(' ? ')' : (c == '[' ? ']' : '}'));
+                    if (in_ == end_) {
+                        failed_ = true;
+                        return;
+                    }
+                    put(*in_);
+                    ++in_;
+                    name_start = pos_;
+                } else if (compact_name_is_ident(c)) {
+                    if (pos_ && out_[pos_ - 1] == ':' && compact_name_equal(out_ + name_start, out_ + pos_, "std::")) {
+                        // Inline namespaces of the Standard Library implementations
+                        if (compact_name_starts_with(in_, end_, "__cxx11::")) {
+                            in_ += 9;
+                            continue;
+                        }
+                        if (compact_name_starts_with(in_, end_, "__1::") || compact_name_starts_with(in_, end_, "__2::")) {
+                            in_ += 5;
+                            continue;
+                        }
+                    }
+                    put(c);
+                    ++in_;
+                } else if (c == ':') {
+                    put(c);
+                    ++in_;
+                } else {
+                    put(c);
+                    ++in_;
+                    name_start = pos_;
+                }
+            }
+        }
+
+        BOOST_CXX14_CONSTEXPR void template_args(std::size_t name_start) noexcept {
+            const std::size_t name_end = pos_;
+            put('<');
+            ++in_;
+
+            std::size_t begins[max_args] = {};  // argument texts without the leading and trailing spaces
+            std::size_t ends[max_args] = {};
+            std::size_t count = 0;
+            bool space_before_close = false;
+            for (;;) {
+                while (in_ != end_ && *in_ == ' ') {
+                    put(' ');
+                    ++in_;
+                }
+                const std::size_t begin = pos_;
+                sequence('>');
+                if (failed_ || in_ == end_) {
+                    failed_ = true;
+                    return;
+                }
+
+                std::size_t end = pos_;
+                while (end > begin && out_[end - 1] == ' ') {
+                    --end;
+                }
+                if (count < max_args) {
+                    begins[count] = begin;
+                    ends[count] = end;
+                }
+                ++count;
+
+                ++in_;
+                if (in_[-1] == ',') {
+                    put(',');
+                    continue;
+                }
+
+                space_before_close = (end != pos_);
+                pos_ = end;
+                break;
+            }
+
+            if (count <= max_args && compact_name_starts_with(out_ + name_start, out_ + name_end, "std::")) {
+                while (count > 1 && is_default_arg(name_start, name_end, begins, ends, count - 1)) {
+                    --count;
+                    pos_ = ends[count - 1];
+                }
+            }
+
+            // Keeping the `> >` style of the input
+            if (space_before_close && out_[pos_ - 1] == '>') {
+                put(' ');
+            }
+            put('>');
+
+            collapse_alias(name_start);
+        }
+
+        BOOST_CXX14_CONSTEXPR bool is_default_arg(std::size_t name_start, std::size_t name_end,
+                                                  const std::size_t (&begins)[max_args], const std::size_t (&ends)[max_args],
+                                                  std::size_t index) const noexcept
+        {
+            const char* it = out_ + begins[index];
+            const char* const end = out_ + ends[index];
+            compact_name_skip_keyword(it, end);
+            if (!compact_name_starts_with(it, end, "std::") || it == end || end[-1] != '>') {
+                return false;
+            }
+            it += 5;
+
+            const char* const template_name = it;
+            while (it != end && *it != '<') {
+                ++it;
+            }
+            if (it == end) {
+                return false;
+            }
+            const char* const template_name_end = it;
+            ++it;
+            const char* const inner_end = end - 1;
+
+            // Pairs of zero terminated names of templates without the "std::" prefix and their default arguments
+            // by positions, the list ends with an empty name. Default arguments are:
+            // '-' no default, 'T' std::char_traits<First>, 'A' std::allocator<First>, 'P' std::allocator<std::pair<const First, Second> >,
+            // 'L' std::less<First>, 'H' std::hash<First>, 'E' std::equal_to<First>, 'D' std::default_delete<First>,
+            // 'Q' std::deque<First>, 'V' std::vector<First>
+            const char* defaults =
+                "basic_string\0-TA\0"
+                "basic_string_view\0-T\0"
+                "vector\0-A\0"
+                "deque\0-A\0"
+                "list\0-A\0"
+                "forward_list\0-A\0"
+                "set\0-LA\0"
+                "multiset\0-LA\0"
+                "map\0--LP\0"
+                "multimap\0--LP\0"
+                "unordered_set\0-HEA\0"
+                "unordered_multiset\0-HEA\0"
+                "unordered_map\0--HEP\0"
+                "unordered_multimap\0--HEP\0"
+                "unique_ptr\0-D\0"
+                "stack\0-Q\0"
+                "queue\0-Q\0"
+                "priority_queue\0-VL\0"
+                "basic_ios\0-T\0"
+                "basic_streambuf\0-T\0"
+                "basic_istream\0-T\0"
+                "basic_ostream\0-T\0"
+                "basic_iostream\0-T\0"
+                "basic_stringbuf\0-TA\0"
+                "basic_istringstream\0-TA\0"
+                "basic_ostringstream\0-TA\0"
+                "basic_stringstream\0-TA\0"
+                "basic_filebuf\0-T\0"
+                "basic_ifstream\0-T\0"
+                "basic_ofstream\0-T\0"
+                "basic_fstream\0-T\0";
+
+            char kind = '-';
+            while (*defaults) {
+                const std::size_t name_size = compact_name_literal_size(defaults);
+                const char* const kinds = defaults + name_size + 1;
+                const std::size_t kinds_size = compact_name_literal_size(kinds);
+                if (compact_name_equal(out_ + name_start + 5, out_ + name_end, defaults)) {
+                    kind = (index < kinds_size ? kinds[index] : '-');
+                    break;
+                }
+                defaults = kinds + kinds_size + 1;
+            }
+
+            const char* expected = "";
+            switch (kind) {
+            case 'T': expected = "char_traits"; break;
+            case 'A': case 'P': expected = "allocator"; break;
+            case 'L': expected = "less"; break;
+            case 'H': expected = "hash"; break;
+            case 'E': expected = "equal_to"; break;
+            case 'D': expected = "default_delete"; break;
+            case 'Q': expected = "deque"; break;
+            case 'V': expected = "vector"; break;
+            default: return false;
+            }
+            if (!compact_name_equal(template_name, template_name_end, expected)) {
+                return false;
+            }
+
+            // std::less<Key> and others
+            const char* first = out_ + begins[0];
+            const char* const first_end = out_ + ends[0];
+            compact_name_skip_keyword(first, first_end);
+
+            const char* inner = it;
+            compact_name_skip_keyword(inner, inner_end);
+            if (kind != 'P') {
+                if (!compact_name_match(inner, inner_end, first, first_end)) {
+                    return false;
+                }
+                compact_name_skip_spaces(inner, inner_end);
+                return inner == inner_end;
+            }
+
+            // std::allocator<std::pair<const Key, Value> > of the maps
+            const char* second = out_ + begins[1];
+            const char* const second_end = out_ + ends[1];
+            compact_name_skip_keyword(second, second_end);
+
+            inner = it;
+            compact_name_skip_keyword(inner, inner_end);
+            if (!compact_name_match(inner, inner_end, "std::pair<")) {
+                return false;
+            }
+            compact_name_skip_keyword(inner, inner_end);
+            const char* const pair_first = inner;
+            if (!(compact_name_match(inner, inner_end, first, first_end) && compact_name_match(inner, inner_end, "const"))) {
+                inner = pair_first;
+                if (!(compact_name_match(inner, inner_end, "const") && compact_name_match(inner, inner_end, first, first_end))) {
+                    return false;
+                }
+            }
+            if (!compact_name_match(inner, inner_end, ",")) {
+                return false;
+            }
+            compact_name_skip_keyword(inner, inner_end);
+            if (!compact_name_match(inner, inner_end, second, second_end) || !compact_name_match(inner, inner_end, ">")) {
+                return false;
+            }
+            compact_name_skip_spaces(inner, inner_end);
+            return inner == inner_end;
+        }
+
+        BOOST_CXX14_CONSTEXPR void collapse_alias(std::size_t name_start) noexcept {
+            // Pairs of zero terminated names without the "std::" prefix, the list ends with an empty name
+            const char* aliases =
+                "basic_string<char>\0string\0"
+                "basic_string<wchar_t>\0wstring\0"
+                "basic_string<char8_t>\0u8string\0"
+                "basic_string<char16_t>\0u16string\0"
+                "basic_string<char32_t>\0u32string\0"
+                "basic_string_view<char>\0string_view\0"
+                "basic_string_view<wchar_t>\0wstring_view\0"
+                "basic_string_view<char8_t>\0u8string_view\0"
+                "basic_string_view<char16_t>\0u16string_view\0"
+                "basic_string_view<char32_t>\0u32string_view\0"
+                "basic_ios<char>\0ios\0"
+                "basic_streambuf<char>\0streambuf\0"
+                "basic_istream<char>\0istream\0"
+                "basic_ostream<char>\0ostream\0"
+                "basic_iostream<char>\0iostream\0"
+                "basic_stringbuf<char>\0stringbuf\0"
+                "basic_istringstream<char>\0istringstream\0"
+                "basic_ostringstream<char>\0ostringstream\0"
+                "basic_stringstream<char>\0stringstream\0"
+                "basic_filebuf<char>\0filebuf\0"
+                "basic_ifstream<char>\0ifstream\0"
+                "basic_ofstream<char>\0ofstream\0"
+                "basic_fstream<char>\0fstream\0";
+
+            if (failed_ || !compact_name_starts_with(out_ + name_start, out_ + pos_, "std::")) {
+                return;
+            }
+
+            const std::size_t begin = name_start + 5;
+            while (*aliases) {
+                const std::size_t from_size = compact_name_literal_size(aliases);
+                const char* const to = aliases + from_size + 1;
+                const std::size_t to_size = compact_name_literal_size(to);
+                if (compact_name_equal(out_ + begin, out_ + pos_, aliases)) {
+                    for (std::size_t i = 0; i < to_size; ++i) {
+                        out_[begin + i] = to[i];
+                    }
+                    pos_ = begin + to_size;
+                    return;
+                }
+                aliases = to + to_size + 1;
+            }
+        }
+
+        const char*         in_;
+        const char*         end_;
+        char*               out_;
+        std::size_t         capacity_;
+        std::size_t         pos_;
+        bool                failed_;
+    };
+
+    /// Removes the namespace qualifiers from the name in place: all the `identifier::` and the anonymous
+    /// namespaces in GCC, Clang and MSVC formats are removed. Qualifiers with template arguments are kept as they are classes,
+    /// as well as the class of a pointer to member: `int ns::Foo::*` becomes `int Foo::*`.
+    /// Returns the new size of the name.
+    BOOST_CXX14_CONSTEXPR inline std::size_t strip_namespaces(char* name, std::size_t size) noexcept {
+        std::size_t read = 0;
+        std::size_t write = 0;
+        while (read < size) {
+            const bool at_name_start = (read == 0 || !compact_name_is_ident(name[read - 1]));
+            if (at_name_start && name[read] == '(' && compact_name_starts_with(name + read, name + size, "(anonymous namespace)::")) {
+                read += 23;
+                continue;
+            }
+            if (at_name_start && name[read] == '{' && compact_name_starts_with(name + read, name + size, "{anonymous}::")) {
+                read += 13;
+                continue;
+            }
+            if (at_name_start && name[read] == '`' && compact_name_starts_with(name + read, name + size, "`anonymous namespace'::")) {
+                read += 23;
+                continue;
+            }
+
+            if (at_name_start && compact_name_is_ident(name[read]) && !(name[read] >= '0' && name[read] <= '9')) {
+                std::size_t end = read;
+                while (end < size && compact_name_is_ident(name[end])) {
+                    ++end;
+                }
+                if (end + 1 < size && name[end] == ':' && name[end + 1] == ':' && !(end + 2 < size && name[end + 2] == '*')) {
+                    read = end + 2;
+                    continue;
+                }
+                while (read < end) {
+                    name[write++] = name[read++];
+                }
+                continue;
+            }
+
+            name[write++] = name[read++];
+        }
+
+        name[write] = '\0';
+        return write;
+    }
+
+    /// Writes the compact form of the name [name, name + size) into the `out`, that must have space
+    /// for size + 1 characters. Standard Library inline namespaces and default template arguments of
+    /// the Standard Library templates are removed, well known aliases are collapsed:
+    /// `std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >` becomes `std::string`.
+    /// Names with unbalanced brackets are copied as is.
+    /// Returns the size of the zero terminated result.
+    BOOST_CXX14_CONSTEXPR inline std::size_t compact_type_name(const char* name, std::size_t size, char* out) noexcept {
+        compact_name_builder builder(name, name + size, out);
+        std::size_t result = size;
+        if (builder.build()) {
+            result = builder.size();
+        } else {
+            for (std::size_t i = 0; i < size; ++i) {
+                out[i] = name[i];
+            }
+        }
+
+        out[result] = '\0';
+        return result;
+    }
+
+    inline std::string compact_type_name(const std::string& name, bool without_namespaces) {
+        std::string result(name.size() + 1, '\0');
+        std::size_t size = detail::compact_type_name(name.data(), name.size(), &result[0]);
+        if (without_namespaces) {
+            size = detail::strip_namespaces(&result[0], size);
+        }
+        result.resize(size);
+        return result;
+    }
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_COMPACT_NAME_HPP
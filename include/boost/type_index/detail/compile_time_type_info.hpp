@@ -14,7 +14,11 @@
 /// Not intended for inclusion from user's code.
 
 #include <boost/config.hpp>
+#include <boost/type_index/detail/compact_name.hpp>
+#include <boost/type_index/detail/normalized_name.hpp>
+#include <boost/type_index/detail/name_hash.hpp>
 
+#include <cstdint>
 #include <cstring>
 #include <type_traits>
 
@@ -23,6 +27,22 @@
 #endif
 
 /// @cond
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && (!defined(_MSC_VER) || _MSC_VER > 1916) && !defined(BOOST_TYPE_INDEX_CTTI_UNTRIMMED_NAMES)
+// Names are copied at compile time into the arrays that contain only the type names
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES
+#endif
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES) && defined(BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES)
+// Compact, short and normalized names are computed at compile time and stored in the same array as the name
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES
+#endif
+
+#if !defined(__clang__) && defined(__GNUC__) && (__GNUC__ >= 7) && !defined(BOOST_NO_CXX17_INLINE_VARIABLES) \
+    && !defined(BOOST_TYPE_INDEX_CTTI_USER_DEFINED_PARSING)
+// Function signature is copied into an array by a single constexpr function call per type
+#define BOOST_TYPE_INDEX_DETAIL_CTTI_SIGNATURE_COPY
+#endif
+
 #if defined(__has_builtin)
 #if __has_builtin(__builtin_constant_p)
 #define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT(x) __builtin_constant_p(x)
@@ -30,9 +50,17 @@
 #if __has_builtin(__builtin_strcmp)
 #define BOOST_TYPE_INDEX_DETAIL_BUILTIN_STRCMP(str1, str2) __builtin_strcmp(str1, str2)
 #endif
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
 #elif defined(__GNUC__)
 #define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT(x) __builtin_constant_p(x)
 #define BOOST_TYPE_INDEX_DETAIL_BUILTIN_STRCMP(str1, str2) __builtin_strcmp(str1, str2)
+#if __GNUC__ >= 9
+#define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#define BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
 #endif
 
 /// @endcond
@@ -96,6 +124,9 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(58, 1, "");
     // sizeof("static const char *boost::detail::ctti<T>::n() [with T = ") - 1, sizeof("]") - 1
     // note: checked on 4.14
 constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(57, 1, ""); }
+#elif defined(BOOST_TYPE_INDEX_DETAIL_CTTI_SIGNATURE_COPY)
+    // sizeof("static constexpr auto boost::detail::ctti<T>::s() [with T = ") - 1, sizeof("]") - 1
+constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(60, 1, ""); }
 #elif defined(__GNUC__) && (__GNUC__ < 7) && !defined(BOOST_NO_CXX14_CONSTEXPR)
     // sizeof("static constexpr char boost::detail::ctti<T>::s() [with unsigned int I = 0u; } T = ") - 1, sizeof("]") - 1
 constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(81, 1, ""); }
@@ -173,6 +204,15 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(0, 0, ""); }
         return last1;
     }
 
+    BOOST_CXX14_CONSTEXPR inline std::size_t constexpr_strlen(const char* str) noexcept {
+        const char* end = str;
+        while (*end != '\0') {
+            ++end;
+        }
+
+        return static_cast<std::size_t>(end - str);
+    }
+
     BOOST_CXX14_CONSTEXPR inline int constexpr_strcmp_loop(const char *v1, const char *v2) noexcept {
         while (*v1 != '\0' && *v1 == *v2) {
             ++v1;
@@ -194,6 +234,44 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(0, 0, ""); }
 #endif
     }
 
+    BOOST_CXX14_CONSTEXPR inline int constexpr_memcmp_loop(const char* v1, const char* v2, std::size_t size) noexcept {
+        for (; size; --size, ++v1, ++v2) {
+            if (*v1 != *v2) {
+                return static_cast<int>(static_cast<unsigned char>(*v1)) - static_cast<unsigned char>(*v2);
+            }
+        }
+
+        return 0;
+    }
+
+    /// Lexicographical three way comparison of [v1, v1 + size1) and [v2, v2 + size2).
+    /// Uses a simple loop at compile time and std::memcmp at runtime: unlike strcmp it
+    /// does not look for the terminating zero and compares long common prefixes of the
+    /// template instantiation names with the widest vector instructions available.
+    BOOST_CXX14_CONSTEXPR inline int constexpr_name_compare(const char* v1, std::size_t size1,
+                                                           const char* v2, std::size_t size2) noexcept
+    {
+        const std::size_t size = (size1 < size2 ? size1 : size2);
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED)
+        const int result = BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT_EVALUATED()
+            ? boost::typeindex::detail::constexpr_memcmp_loop(v1, v2, size)
+            : (size ? std::memcmp(v1, v2, size) : 0);
+#elif !defined(BOOST_NO_CXX14_CONSTEXPR) && defined(BOOST_TYPE_INDEX_DETAIL_IS_CONSTANT)
+        const int result = (boost::typeindex::detail::is_constant_string(v1) && boost::typeindex::detail::is_constant_string(v2))
+            ? boost::typeindex::detail::constexpr_memcmp_loop(v1, v2, size)
+            : (size ? std::memcmp(v1, v2, size) : 0);
+#elif !defined(BOOST_NO_CXX14_CONSTEXPR)
+        const int result = boost::typeindex::detail::constexpr_memcmp_loop(v1, v2, size);
+#else
+        const int result = (size ? std::memcmp(v1, v2, size) : 0);
+#endif
+        if (result) {
+            return result;
+        }
+
+        return (size1 < size2 ? -1 : (size1 > size2 ? 1 : 0));
+    }
+
     template <unsigned int ArrayLength>
     BOOST_CXX14_CONSTEXPR inline const char* skip_begining_runtime(const char* begin) noexcept {
         const char* const it = detail::constexpr_search(
@@ -212,7 +290,25 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(0, 0, ""); }
         ;
     }
 
-#if !defined(__clang__) && defined(__GNUC__) && !defined(BOOST_NO_CXX14_CONSTEXPR)
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_SIGNATURE_COPY)
+    /// Function signature without the first skip().size_at_begin characters
+    template <std::size_t N>
+    struct ctti_signature_tail {
+        char data[N];
+    };
+
+    // Instantiated once per signature length rather than once per character
+    template <std::size_t N>
+    constexpr ctti_signature_tail<N - skip().size_at_begin> make_ctti_signature_tail(const char (&signature)[N]) noexcept {
+        detail::assert_compile_time_legths<(N > skip().size_at_begin + skip().size_at_end)>();
+
+        ctti_signature_tail<N - skip().size_at_begin> tail{};
+        for (std::size_t i = skip().size_at_begin; i < N; ++i) {
+            tail.data[i - skip().size_at_begin] = signature[i];
+        }
+        return tail;
+    }
+#elif !defined(__clang__) && defined(__GNUC__) && !defined(BOOST_NO_CXX14_CONSTEXPR)
     template <unsigned int... I>
     struct index_seq {};
 
@@ -252,6 +348,9 @@ constexpr ctti_skip skip() noexcept { return detail::make_ctti_skip(0, 0, ""); }
     constexpr char cstring<C...>::data_[];
 #endif
 
+    template <class T>
+    struct BOOST_SYMBOL_VISIBLE ctti_entry_holder;
+
 }}} // namespace boost::typeindex::detail
 
 namespace boost { namespace detail {
@@ -262,7 +361,22 @@ namespace boost { namespace detail {
 template <class T>
 struct ctti {
 
-#if !defined(__clang__) && defined(__GNUC__) && !defined(BOOST_NO_CXX14_CONSTEXPR)
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_SIGNATURE_COPY)
+    constexpr static auto s() noexcept { // signature
+    #if defined(BOOST_TYPE_INDEX_FUNCTION_SIGNATURE)
+        return ::boost::typeindex::detail::make_ctti_signature_tail(BOOST_TYPE_INDEX_FUNCTION_SIGNATURE);
+    #else
+        return ::boost::typeindex::detail::make_ctti_signature_tail(__PRETTY_FUNCTION__);
+    #endif
+    }
+
+    static constexpr auto signature_ = s();
+
+    /// Returns raw name. Must be as short, as possible, to avoid code bloat
+    constexpr static const char* n() noexcept {
+        return signature_.data;
+    }
+#elif !defined(__clang__) && defined(__GNUC__) && !defined(BOOST_NO_CXX14_CONSTEXPR)
     //helper functions
     template <unsigned int I>
     constexpr static char s() noexcept { // step
@@ -340,10 +454,294 @@ struct ctti {
     #endif
     }
 #endif
+
+    /// Returns length of the type name without the compiler specific trailing characters and spaces.
+    BOOST_CXX14_CONSTEXPR static std::size_t size() noexcept {
+        return ::boost::typeindex::detail::ctti_entry_holder<T>::get()->size;
+    }
 };
 
 }} // namespace boost::detail
 
+namespace boost { namespace typeindex { namespace detail {
+
+/// Offset of the names that are not computed at compile time
+BOOST_CONSTEXPR_OR_CONST std::uint32_t ctti_no_offset = 0xFFFFFFFFu;
+
+/// Per-type record that is shared by all the ctti_type_index instances of the same type.
+///
+/// If BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES is defined, all the names of a type are stored in a single
+/// array, so the entry has a single pointer that requires relocation at load time. Names that are endings of
+/// other names are not stored separately.
+struct ctti_entry {
+    const char*     name;               // raw name, trimmed and zero terminated if BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES is defined
+    std::size_t     size;               // length of the name without the trailing skip().size_at_end characters and spaces
+    std::uint64_t   hash;               // hash of the first `size` characters of the name
+    std::uint64_t   normalized_hash;    // hash of the normalized_name(), valid only if normalized_offset is not ctti_no_offset
+    std::uint32_t   compact_offset;     // name + compact_offset is the zero terminated compact_name(), ctti_no_offset if it is not computed at compile time
+    std::uint32_t   compact_size;
+    std::uint32_t   short_offset;       // name + short_offset is the zero terminated short_name(), ctti_no_offset if it is not computed at compile time
+    std::uint32_t   short_size;
+    std::uint32_t   normalized_offset;  // name + normalized_offset is the zero terminated normalized_name(), ctti_no_offset if it is not computed at compile time
+    std::uint32_t   normalized_size;
+};
+
+BOOST_CXX14_CONSTEXPR inline std::size_t ctti_name_size(const char* name) noexcept {
+    std::size_t size = detail::constexpr_strlen(name + skip().size_at_end);
+    while (size && name[size - 1] == ' ') --size; // MSVC sometimes adds whitespaces
+    return size;
+}
+
+BOOST_CXX14_CONSTEXPR inline ctti_entry make_ctti_entry(const char* name, std::size_t size) noexcept {
+    return ctti_entry{
+        name, size, detail::constexpr_name_hash(name, size), 0,
+        ctti_no_offset, 0, ctti_no_offset, 0, ctti_no_offset, 0
+    };
+}
+
+BOOST_CXX14_CONSTEXPR inline ctti_entry make_ctti_entry(const char* name) noexcept {
+    return detail::make_ctti_entry(name, detail::ctti_name_size(name));
+}
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+/// Zero terminated copy of the first N characters of the raw name
+template <std::size_t N>
+struct ctti_name_storage {
+    char data[N + 1];
+};
+
+template <std::size_t N>
+constexpr ctti_name_storage<N> make_ctti_name_storage(const char* name) noexcept {
+    ctti_name_storage<N> storage{};
+    for (std::size_t i = 0; i < N; ++i) {
+        storage.data[i] = name[i];
+    }
+
+    return storage;
+}
+
+template <class T>
+struct ctti_name_holder {
+    static constexpr std::size_t size = detail::ctti_name_size(boost::detail::ctti<T>::n());
+
+    // Explicit alignment prevents compilers from aligning the arrays to the vector register size
+    alignas(1) static constexpr ctti_name_storage<size> name = detail::make_ctti_name_storage<size>(boost::detail::ctti<T>::n());
+};
+
+template <class T>
+constexpr std::size_t ctti_name_holder<T>::size;
+
+template <class T>
+alignas(1) constexpr ctti_name_storage<ctti_name_holder<T>::size> ctti_name_holder<T>::name;
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+/// Compact form of a name of N characters. Used only at compile time to get the size of the compact name.
+template <std::size_t N>
+struct ctti_compact_name_storage {
+    char        data[N + 1];
+    std::size_t size;
+};
+
+template <std::size_t N>
+constexpr ctti_compact_name_storage<N> make_ctti_compact_name_storage(const char* name) noexcept {
+    ctti_compact_name_storage<N> storage{};
+    storage.size = detail::compact_type_name(name, N, storage.data);
+    return storage;
+}
+
+template <std::size_t N>
+constexpr ctti_compact_name_storage<N> make_ctti_short_name_storage(const char* compact_name) noexcept {
+    ctti_compact_name_storage<N> storage{};
+    for (std::size_t i = 0; i < N; ++i) {
+        storage.data[i] = compact_name[i];
+    }
+    storage.size = detail::strip_namespaces(storage.data, N);
+    return storage;
+}
+
+/// Normalized form of a compact name of N characters. Used only at compile time to get the size of the normalized name.
+template <std::size_t N>
+struct ctti_normalized_name_storage {
+    char        data[N * 2 + 1];
+    std::size_t size;
+};
+
+template <std::size_t N>
+constexpr ctti_normalized_name_storage<N> make_ctti_normalized_name_storage(const char* compact_name) noexcept {
+    ctti_normalized_name_storage<N> storage{};
+    char buffer[N * 2 + 1] = {};
+    storage.size = detail::normalize_type_name(compact_name, N, buffer, storage.data);
+    return storage;
+}
+
+/// True if [part, part + part_size) is the ending of [name, name + size)
+constexpr bool ctti_is_suffix(const char* name, std::size_t size, const char* part, std::size_t part_size) noexcept {
+    return part_size <= size && !detail::constexpr_memcmp_loop(name + size - part_size, part, part_size);
+}
+
+/// Positions of the names in the array of all the names of a type
+struct ctti_names_layout {
+    std::size_t compact_offset;
+    std::size_t short_offset;
+    std::size_t normalized_offset;
+    std::size_t size;               // size of the whole array, including the zero terminators
+};
+
+constexpr ctti_names_layout make_ctti_names_layout(const char* name, std::size_t size,
+                                                   const char* compact_name, std::size_t compact_size,
+                                                   const char* short_name, std::size_t short_size,
+                                                   const char* normalized_name, std::size_t normalized_size) noexcept
+{
+    ctti_names_layout layout{0, 0, 0, size + 1};
+    if (detail::ctti_is_suffix(name, size, compact_name, compact_size)) {
+        layout.compact_offset = size - compact_size;
+    } else {
+        layout.compact_offset = layout.size;
+        layout.size += compact_size + 1;
+    }
+
+    if (detail::ctti_is_suffix(compact_name, compact_size, short_name, short_size)) {
+        layout.short_offset = layout.compact_offset + compact_size - short_size;
+    } else {
+        layout.short_offset = layout.size;
+        layout.size += short_size + 1;
+    }
+
+    if (detail::ctti_is_suffix(compact_name, compact_size, normalized_name, normalized_size)) {
+        layout.normalized_offset = layout.compact_offset + compact_size - normalized_size;
+    } else if (detail::ctti_is_suffix(name, size, normalized_name, normalized_size)) {
+        layout.normalized_offset = size - normalized_size;
+    } else {
+        layout.normalized_offset = layout.size;
+        layout.size += normalized_size + 1;
+    }
+
+    return layout;
+}
+
+/// All the zero terminated names of a type, one after another
+template <std::size_t N>
+struct ctti_names_storage {
+    char data[N];
+};
+
+constexpr void ctti_copy_name(char* out, const char* name, std::size_t size) noexcept {
+    for (std::size_t i = 0; i < size; ++i) {
+        out[i] = name[i];
+    }
+    out[size] = '\0';
+}
+
+template <std::size_t N>
+constexpr ctti_names_storage<N> make_ctti_names_storage(const ctti_names_layout& layout, const char* name, std::size_t size,
+                                                        const char* compact_name, std::size_t compact_size,
+                                                        const char* short_name, std::size_t short_size,
+                                                        const char* normalized_name, std::size_t normalized_size) noexcept
+{
+    // Names that are endings of other names are written over the same characters
+    ctti_names_storage<N> storage{};
+    detail::ctti_copy_name(storage.data, name, size);
+    detail::ctti_copy_name(storage.data + layout.compact_offset, compact_name, compact_size);
+    detail::ctti_copy_name(storage.data + layout.short_offset, short_name, short_size);
+    detail::ctti_copy_name(storage.data + layout.normalized_offset, normalized_name, normalized_size);
+    return storage;
+}
+
+/// Separate from the ctti_name_holder, so that the compact names computations are instantiated only if requested
+template <class T>
+struct ctti_compact_names_holder {
+    // Used only at compile time. Only the `names` array gets into the binary.
+    static constexpr std::size_t size = ctti_name_holder<T>::size;
+    static constexpr const ctti_name_storage<size>& name = ctti_name_holder<T>::name;
+    static constexpr ctti_compact_name_storage<size> compact = detail::make_ctti_compact_name_storage<size>(name.data);
+    static constexpr ctti_compact_name_storage<compact.size> short_name
+        = detail::make_ctti_short_name_storage<compact.size>(compact.data);
+    static constexpr ctti_normalized_name_storage<compact.size> normalized
+        = detail::make_ctti_normalized_name_storage<compact.size>(compact.data);
+    static constexpr ctti_names_layout layout = detail::make_ctti_names_layout(
+        name.data, size, compact.data, compact.size, short_name.data, short_name.size, normalized.data, normalized.size
+    );
+
+    // Explicit alignment prevents compilers from aligning the arrays to the vector register size
+    alignas(1) static constexpr ctti_names_storage<layout.size> names = detail::make_ctti_names_storage<layout.size>(
+        layout, name.data, size, compact.data, compact.size, short_name.data, short_name.size, normalized.data, normalized.size
+    );
+};
+
+template <class T>
+constexpr std::size_t ctti_compact_names_holder<T>::size;
+
+template <class T>
+constexpr const ctti_name_storage<ctti_compact_names_holder<T>::size>& ctti_compact_names_holder<T>::name;
+
+template <class T>
+constexpr ctti_compact_name_storage<ctti_compact_names_holder<T>::size> ctti_compact_names_holder<T>::compact;
+
+template <class T>
+constexpr ctti_compact_name_storage<ctti_compact_names_holder<T>::compact.size> ctti_compact_names_holder<T>::short_name;
+
+template <class T>
+constexpr ctti_normalized_name_storage<ctti_compact_names_holder<T>::compact.size> ctti_compact_names_holder<T>::normalized;
+
+template <class T>
+constexpr ctti_names_layout ctti_compact_names_holder<T>::layout;
+
+template <class T>
+alignas(1) constexpr ctti_names_storage<ctti_compact_names_holder<T>::layout.size> ctti_compact_names_holder<T>::names;
+
+template <class T>
+constexpr ctti_entry make_ctti_entry() noexcept {
+    typedef ctti_compact_names_holder<T> holder;
+    return ctti_entry{
+        holder::names.data, holder::size, detail::constexpr_name_hash(holder::name.data, holder::size),
+        detail::constexpr_name_hash(holder::normalized.data, holder::normalized.size),
+        static_cast<std::uint32_t>(holder::layout.compact_offset), static_cast<std::uint32_t>(holder::compact.size),
+        static_cast<std::uint32_t>(holder::layout.short_offset), static_cast<std::uint32_t>(holder::short_name.size),
+        static_cast<std::uint32_t>(holder::layout.normalized_offset), static_cast<std::uint32_t>(holder::normalized.size)
+    };
+}
+#else
+template <class T>
+constexpr ctti_entry make_ctti_entry() noexcept {
+    typedef ctti_name_holder<T> holder;
+    return detail::make_ctti_entry(holder::name.data, holder::size);
+}
+#endif
+#endif
+
+template <class T>
+struct BOOST_SYMBOL_VISIBLE ctti_entry_holder {
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+    // Explicit alignment prevents compilers from aligning the entries to the vector register size
+    alignas(ctti_entry) static constexpr ctti_entry value = detail::make_ctti_entry<T>();
+
+    constexpr static const ctti_entry* get() noexcept {
+        return &value;
+    }
+#elif !defined(BOOST_NO_CXX14_CONSTEXPR)
+    static constexpr ctti_entry value = detail::make_ctti_entry(boost::detail::ctti<T>::n());
+
+    constexpr static const ctti_entry* get() noexcept {
+        return &value;
+    }
+#else
+    // No C++14 constexpr, computing the entry once at runtime
+    static const ctti_entry* get() noexcept {
+        static const ctti_entry value = detail::make_ctti_entry(boost::detail::ctti<T>::n());
+        return &value;
+    }
+#endif
+};
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+template <class T>
+alignas(ctti_entry) constexpr ctti_entry ctti_entry_holder<T>::value;
+#elif !defined(BOOST_NO_CXX14_CONSTEXPR)
+template <class T>
+constexpr ctti_entry ctti_entry_holder<T>::value;
+#endif
+
+}}} // namespace boost::typeindex::detail
 
 
 #endif // BOOST_TYPE_INDEX_DETAIL_COMPILE_TIME_TYPE_INFO_HPP
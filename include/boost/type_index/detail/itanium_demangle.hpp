@@ -0,0 +1,1593 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_ITANIUM_DEMANGLE_HPP
+#define BOOST_TYPE_INDEX_DETAIL_ITANIUM_DEMANGLE_HPP
+
+/// \file itanium_demangle.hpp
+/// \brief Contains allocation free demangler for the Itanium C++ ABI type names.
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail { namespace itanium {
+
+// The parser builds a tree of nodes in a fixed size arena, the printer walks the tree and
+// writes the name into the caller's buffer. Nodes and printing rules mirror the ones of the
+// libiberty demangler, so the output is the same as the output of libstdc++ __cxa_demangle.
+// Only the constructs that appear in the std::type_info::name() are supported: there are
+// no expressions, template parameters, operators and special names.
+
+enum class parse_error {
+    none,
+    invalid,        // not a mangled type name
+    unsupported,    // valid name that uses constructs not supported by this demangler
+    too_complex     // the arena, the substitution table, the nesting depth or the output limit is exhausted
+};
+
+enum class node_kind : unsigned char {
+    builtin,            // str
+    name,               // str
+    std_substitution,   // str
+    tagged_name,        // left[abi:right]
+    qualified_name,     // left::right
+    template_name,      // left<right>
+    arglist,            // left is the element, right is the rest of the list
+    restrict_qualifier, // qualifiers of the left
+    volatile_qualifier,
+    const_qualifier,
+    restrict_this,      // qualifiers of the left function
+    volatile_this,
+    const_this,
+    reference_this,
+    rvalue_reference_this,
+    noexcept_this,
+    pointer,            // left*
+    reference,          // left&
+    rvalue_reference,   // left&&
+    pointer_to_member,  // right left::*
+    function,           // left is the return type, right is the arglist of parameters
+    array,              // right [left]
+    literal,            // (left)str
+    negative_literal,   // (left)-str
+    typed_name,         // left is the function name, right is the function type
+    local_name,         // left::right
+    lambda,             // {lambda(right)#number}
+    unnamed_type,       // {unnamed type#number}
+    vendor_type         // left
+};
+
+enum class literal_format : unsigned char {
+    cast,   // (type)value
+    int_, unsigned_, long_, unsigned_long, long_long, unsigned_long_long,
+    bool_, float_, void_
+};
+
+struct node {
+    node_kind       kind;
+    literal_format  format;
+    const char*     str;
+    std::size_t     len;    // length of the str or the number of lambda and unnamed type
+    node*           left;
+    node*           right;
+};
+
+inline bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+inline bool is_upper(char c) noexcept { return c >= 'A' && c <= 'Z'; }
+inline bool is_lower(char c) noexcept { return c >= 'a' && c <= 'z'; }
+
+inline bool is_cv_qualifier(node_kind kind) noexcept {
+    return kind == node_kind::restrict_qualifier
+        || kind == node_kind::volatile_qualifier
+        || kind == node_kind::const_qualifier;
+}
+
+inline bool is_function_qualifier(node_kind kind) noexcept {
+    return kind == node_kind::restrict_this
+        || kind == node_kind::volatile_this
+        || kind == node_kind::const_this
+        || kind == node_kind::reference_this
+        || kind == node_kind::rvalue_reference_this
+        || kind == node_kind::noexcept_this;
+}
+
+class parser {
+public:
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_nodes = 256;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_substitutions = 128;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_qualifiers = 8;
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_depth = 256;
+
+    parser(const char* first, const char* last) noexcept
+        : p_(first), end_(last), nodes_used_(0), substitutions_used_(0), depth_(0), error_(parse_error::none)
+    {}
+
+    /// Returns the tree of the whole type name or nullptr on error.
+    const node* parse() noexcept {
+        node* type = parse_type();
+        if (type && p_ != end_) {
+            return fail(parse_error::invalid);
+        }
+        return type;
+    }
+
+    parse_error error() const noexcept {
+        return error_;
+    }
+
+private:
+    const char*     p_;
+    const char*     end_;
+    node            nodes_[max_nodes];
+    std::size_t     nodes_used_;
+    node*           substitutions_[max_substitutions];
+    std::size_t     substitutions_used_;
+    std::size_t     depth_;
+    parse_error     error_;
+
+    // Counts the nesting of parse_type(), parse_name() and parse_template_args(), all the recursion
+    // goes through them. The limit keeps names like `PPPP...i` from exhausting the stack.
+    class depth_guard {
+    public:
+        explicit depth_guard(parser& p) noexcept
+            : parser_(p)
+        {
+            ++parser_.depth_;
+        }
+
+        ~depth_guard() {
+            --parser_.depth_;
+        }
+
+        bool exceeded() const noexcept {
+            return parser_.depth_ > max_depth;
+        }
+
+    private:
+        parser& parser_;
+    };
+
+    char peek() const noexcept {
+        return p_ != end_ ? *p_ : '\0';
+    }
+
+    char peek_next() const noexcept {
+        return (p_ != end_ && p_ + 1 != end_) ? p_[1] : '\0';
+    }
+
+    node* fail(parse_error error) noexcept {
+        if (error_ == parse_error::none) {
+            error_ = error;
+        }
+        return nullptr;
+    }
+
+    bool consume(char c) noexcept {
+        if (peek() != c) {
+            fail(parse_error::invalid);
+            return false;
+        }
+        ++p_;
+        return true;
+    }
+
+    node* make(node_kind kind, node* left = nullptr, node* right = nullptr) noexcept {
+        if (nodes_used_ == max_nodes) {
+            return fail(parse_error::too_complex);
+        }
+        node* const result = &nodes_[nodes_used_++];
+        result->kind = kind;
+        result->format = literal_format::cast;
+        result->str = nullptr;
+        result->len = 0;
+        result->left = left;
+        result->right = right;
+        return result;
+    }
+
+    node* make_string(node_kind kind, const char* str, std::size_t len) noexcept {
+        node* const result = make(kind);
+        if (result) {
+            result->str = str;
+            result->len = len;
+        }
+        return result;
+    }
+
+    bool add_substitution(node* n) noexcept {
+        if (substitutions_used_ == max_substitutions) {
+            fail(parse_error::too_complex);
+            return false;
+        }
+        substitutions_[substitutions_used_++] = n;
+        return true;
+    }
+
+    bool parse_number(std::size_t& result) noexcept {
+        result = 0;
+        while (is_digit(peek())) {
+            if (result > 100000000) {
+                fail(parse_error::invalid);
+                return false;
+            }
+            result = result * 10 + static_cast<std::size_t>(*p_ - '0');
+            ++p_;
+        }
+        return true;
+    }
+
+    // [<number>] _
+    bool parse_compact_number(std::size_t& result) noexcept {
+        result = 0;
+        if (peek() != '_') {
+            if (!is_digit(peek()) || !parse_number(result)) {
+                fail(parse_error::invalid);
+                return false;
+            }
+            ++result;
+        }
+        return consume('_');
+    }
+
+    node* parse_builtin(const char* name, literal_format format, std::size_t mangled_len) noexcept {
+        p_ += mangled_len;
+        node* const result = make_string(node_kind::builtin, name, std::strlen(name));
+        if (result) {
+            result->format = format;
+        }
+        return result;
+    }
+
+    // <type>
+    node* parse_type() noexcept {
+        const depth_guard guard(*this);
+        if (guard.exceeded()) {
+            return fail(parse_error::too_complex);
+        }
+        if (is_type_qualifier()) {
+            return parse_qualified_type();
+        }
+
+        bool can_substitute = true;
+        node* result = nullptr;
+        switch (peek()) {
+        case 'a': result = parse_builtin("signed char", literal_format::cast, 1); can_substitute = false; break;
+        case 'b': result = parse_builtin("bool", literal_format::bool_, 1); can_substitute = false; break;
+        case 'c': result = parse_builtin("char", literal_format::cast, 1); can_substitute = false; break;
+        case 'd': result = parse_builtin("double", literal_format::float_, 1); can_substitute = false; break;
+        case 'e': result = parse_builtin("long double", literal_format::float_, 1); can_substitute = false; break;
+        case 'f': result = parse_builtin("float", literal_format::float_, 1); can_substitute = false; break;
+        case 'g': result = parse_builtin("__float128", literal_format::float_, 1); can_substitute = false; break;
+        case 'h': result = parse_builtin("unsigned char", literal_format::cast, 1); can_substitute = false; break;
+        case 'i': result = parse_builtin("int", literal_format::int_, 1); can_substitute = false; break;
+        case 'j': result = parse_builtin("unsigned int", literal_format::unsigned_, 1); can_substitute = false; break;
+        case 'l': result = parse_builtin("long", literal_format::long_, 1); can_substitute = false; break;
+        case 'm': result = parse_builtin("unsigned long", literal_format::unsigned_long, 1); can_substitute = false; break;
+        case 'n': result = parse_builtin("__int128", literal_format::cast, 1); can_substitute = false; break;
+        case 'o': result = parse_builtin("unsigned __int128", literal_format::cast, 1); can_substitute = false; break;
+        case 's': result = parse_builtin("short", literal_format::cast, 1); can_substitute = false; break;
+        case 't': result = parse_builtin("unsigned short", literal_format::cast, 1); can_substitute = false; break;
+        case 'v': result = parse_builtin("void", literal_format::void_, 1); can_substitute = false; break;
+        case 'w': result = parse_builtin("wchar_t", literal_format::cast, 1); can_substitute = false; break;
+        case 'x': result = parse_builtin("long long", literal_format::long_long, 1); can_substitute = false; break;
+        case 'y': result = parse_builtin("unsigned long long", literal_format::unsigned_long_long, 1); can_substitute = false; break;
+        case 'z': result = parse_builtin("...", literal_format::cast, 1); can_substitute = false; break;
+
+        case 'D':
+            can_substitute = false;
+            switch (peek_next()) {
+            case 'a': result = parse_builtin("auto", literal_format::cast, 2); break;
+            case 'c': result = parse_builtin("decltype(auto)", literal_format::cast, 2); break;
+            case 'd': result = parse_builtin("decimal64", literal_format::cast, 2); break;
+            case 'e': result = parse_builtin("decimal128", literal_format::cast, 2); break;
+            case 'f': result = parse_builtin("decimal32", literal_format::cast, 2); break;
+            case 'h': result = parse_builtin("half", literal_format::float_, 2); break;
+            case 'i': result = parse_builtin("char32_t", literal_format::cast, 2); break;
+            case 'n': result = parse_builtin("decltype(nullptr)", literal_format::cast, 2); break;
+            case 's': result = parse_builtin("char16_t", literal_format::cast, 2); break;
+            case 'u': result = parse_builtin("char8_t", literal_format::cast, 2); break;
+            default:
+                // decltype, pack expansions, vector types, _FloatN
+                return fail(parse_error::unsupported);
+            }
+            break;
+
+        case 'u':
+            ++p_;
+            result = parse_source_name();
+            if (result) {
+                result = make(node_kind::vendor_type, result);
+            }
+            break;
+
+        case 'F':
+            result = parse_function_type();
+            break;
+
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+        case 'N': case 'Z':
+            result = parse_name();
+            break;
+
+        case 'A':
+            result = parse_array_type();
+            break;
+
+        case 'M':
+            result = parse_pointer_to_member_type();
+            break;
+
+        case 'S': {
+            const char next = peek_next();
+            if (is_digit(next) || next == '_' || is_upper(next)) {
+                result = parse_substitution();
+                if (result && peek() == 'I') {
+                    // Substitution of a template name
+                    node* const args = parse_template_args();
+                    result = (args ? make(node_kind::template_name, result, args) : nullptr);
+                } else {
+                    can_substitute = false;
+                }
+            } else {
+                result = parse_name();
+                if (result && result->kind == node_kind::std_substitution) {
+                    can_substitute = false;
+                }
+            }
+            break;
+        }
+
+        case 'P':
+            ++p_;
+            result = parse_type();
+            if (result) {
+                result = make(node_kind::pointer, result);
+            }
+            break;
+
+        case 'R':
+            ++p_;
+            result = parse_type();
+            if (result) {
+                result = make(node_kind::reference, result);
+            }
+            break;
+
+        case 'O':
+            ++p_;
+            result = parse_type();
+            if (result) {
+                result = make(node_kind::rvalue_reference, result);
+            }
+            break;
+
+        case 'T':   // template parameters
+        case 'C':   // complex
+        case 'G':   // imaginary
+        case 'U':   // vendor qualifiers
+            return fail(parse_error::unsupported);
+
+        default:
+            return fail(parse_error::invalid);
+        }
+
+        if (!result) {
+            return nullptr;
+        }
+        if (can_substitute && !add_substitution(result)) {
+            return nullptr;
+        }
+        return result;
+    }
+
+    bool is_type_qualifier() const noexcept {
+        const char c = peek();
+        if (c == 'r' || c == 'V' || c == 'K') {
+            return true;
+        }
+        if (c == 'D') {
+            const char next = peek_next();
+            return next == 'x' || next == 'o' || next == 'O' || next == 'w';
+        }
+        return false;
+    }
+
+    // <CV-qualifiers>, the first one is the outermost
+    bool parse_cv_qualifiers(node_kind (&qualifiers)[max_qualifiers], std::size_t& count, bool member_function) noexcept {
+        count = 0;
+        while (is_type_qualifier()) {
+            if (count == max_qualifiers) {
+                fail(parse_error::too_complex);
+                return false;
+            }
+
+            const char c = *p_;
+            ++p_;
+            if (c == 'r') {
+                qualifiers[count] = (member_function ? node_kind::restrict_this : node_kind::restrict_qualifier);
+            } else if (c == 'V') {
+                qualifiers[count] = (member_function ? node_kind::volatile_this : node_kind::volatile_qualifier);
+            } else if (c == 'K') {
+                qualifiers[count] = (member_function ? node_kind::const_this : node_kind::const_qualifier);
+            } else if (*p_ == 'o') {
+                ++p_;
+                qualifiers[count] = node_kind::noexcept_this;
+            } else {
+                // transaction_safe, noexcept(expression), throw(types)
+                fail(parse_error::unsupported);
+                return false;
+            }
+            ++count;
+        }
+
+        if (!member_function && peek() == 'F') {
+            // Qualifiers of a function type apply to `this`
+            for (std::size_t i = 0; i < count; ++i) {
+                switch (qualifiers[i]) {
+                case node_kind::restrict_qualifier: qualifiers[i] = node_kind::restrict_this; break;
+                case node_kind::volatile_qualifier: qualifiers[i] = node_kind::volatile_this; break;
+                case node_kind::const_qualifier: qualifiers[i] = node_kind::const_this; break;
+                default: break;
+                }
+            }
+        }
+        return true;
+    }
+
+    node* apply_qualifiers(const node_kind (&qualifiers)[max_qualifiers], std::size_t count, node* inner) noexcept {
+        while (inner && count) {
+            --count;
+            inner = make(qualifiers[count], inner);
+        }
+        return inner;
+    }
+
+    // <CV-qualifiers> <type>
+    node* parse_qualified_type() noexcept {
+        node_kind qualifiers[max_qualifiers];
+        std::size_t count = 0;
+        if (!parse_cv_qualifiers(qualifiers, count, false)) {
+            return nullptr;
+        }
+
+        // Unqualified function type is not a substitution candidate
+        node* inner = (peek() == 'F' ? parse_function_type() : parse_type());
+        if (!inner) {
+            return nullptr;
+        }
+
+        node* ref_qualifier = nullptr;
+        if (inner->kind == node_kind::reference_this || inner->kind == node_kind::rvalue_reference_this) {
+            // Ref-qualifier is printed after the cv-qualifiers
+            ref_qualifier = inner;
+            inner = inner->left;
+        }
+
+        node* result = apply_qualifiers(qualifiers, count, inner);
+        if (result && ref_qualifier) {
+            ref_qualifier->left = result;
+            result = ref_qualifier;
+        }
+        if (!result || !add_substitution(result)) {
+            return nullptr;
+        }
+        return result;
+    }
+
+    // F [Y] <bare-function-type> [<ref-qualifier>] E
+    node* parse_function_type() noexcept {
+        if (!consume('F')) {
+            return nullptr;
+        }
+        if (peek() == 'Y') {
+            ++p_;
+        }
+
+        node* result = parse_bare_function_type(true);
+        if (result) {
+            result = parse_ref_qualifier(result);
+        }
+        if (!result || !consume('E')) {
+            return nullptr;
+        }
+        return result;
+    }
+
+    node* parse_ref_qualifier(node* function) noexcept {
+        if (peek() == 'R') {
+            ++p_;
+            return make(node_kind::reference_this, function);
+        }
+        if (peek() == 'O') {
+            ++p_;
+            return make(node_kind::rvalue_reference_this, function);
+        }
+        return function;
+    }
+
+    // [J] [<return type>] <parameter types>
+    node* parse_bare_function_type(bool has_return_type) noexcept {
+        if (peek() == 'J') {
+            ++p_;
+            has_return_type = true;
+        }
+
+        node* return_type = nullptr;
+        if (has_return_type) {
+            return_type = parse_type();
+            if (!return_type) {
+                return nullptr;
+            }
+        }
+
+        node* const parameters = parse_parameters();
+        return (parameters ? make(node_kind::function, return_type, parameters) : nullptr);
+    }
+
+    node* parse_parameters() noexcept {
+        node* head = nullptr;
+        node** tail = &head;
+        for (;;) {
+            const char c = peek();
+            if (c == '\0' || c == 'E' || c == '.') {
+                break;
+            }
+            if ((c == 'R' || c == 'O') && peek_next() == 'E') {
+                // Ref-qualifier of the function
+                break;
+            }
+
+            node* const type = parse_type();
+            if (!type) {
+                return nullptr;
+            }
+            *tail = make(node_kind::arglist, type);
+            if (!*tail) {
+                return nullptr;
+            }
+            tail = &(*tail)->right;
+        }
+
+        if (!head) {
+            return fail(parse_error::invalid);
+        }
+        if (!head->right && head->left->kind == node_kind::builtin && head->left->format == literal_format::void_) {
+            // Single void parameter means no parameters
+            head->left = nullptr;
+        }
+        return head;
+    }
+
+    // <name>
+    node* parse_name() noexcept {
+        const depth_guard guard(*this);
+        if (guard.exceeded()) {
+            return fail(parse_error::too_complex);
+        }
+        switch (peek()) {
+        case 'N':
+            return parse_nested_name();
+
+        case 'Z':
+            return parse_local_name();
+
+        case 'U':
+            return parse_unqualified_name();
+
+        case 'S': {
+            node* result = nullptr;
+            bool from_substitution = true;
+            if (peek_next() != 't') {
+                result = parse_substitution();
+            } else {
+                p_ += 2;
+                node* const std_name = make_string(node_kind::name, "std", 3);
+                node* const name = (std_name ? parse_unqualified_name() : nullptr);
+                result = (name ? make(node_kind::qualified_name, std_name, name) : nullptr);
+                from_substitution = false;
+            }
+
+            if (result && peek() == 'I') {
+                // <unscoped-template-name> <template-args>
+                if (!from_substitution && !add_substitution(result)) {
+                    return nullptr;
+                }
+                node* const args = parse_template_args();
+                result = (args ? make(node_kind::template_name, result, args) : nullptr);
+            }
+            return result;
+        }
+
+        default: {
+            node* result = parse_unqualified_name();
+            if (result && peek() == 'I') {
+                // <unscoped-template-name> <template-args>
+                if (!add_substitution(result)) {
+                    return nullptr;
+                }
+                node* const args = parse_template_args();
+                result = (args ? make(node_kind::template_name, result, args) : nullptr);
+            }
+            return result;
+        }
+        }
+    }
+
+    // N [<CV-qualifiers>] [<ref-qualifier>] <prefix> E
+    node* parse_nested_name() noexcept {
+        if (!consume('N')) {
+            return nullptr;
+        }
+
+        node_kind qualifiers[max_qualifiers];
+        std::size_t count = 0;
+        if (!parse_cv_qualifiers(qualifiers, count, true)) {
+            return nullptr;
+        }
+
+        node_kind ref_qualifier = node_kind::name;
+        if (peek() == 'R' || peek() == 'O') {
+            ref_qualifier = (*p_ == 'R' ? node_kind::reference_this : node_kind::rvalue_reference_this);
+            ++p_;
+        }
+
+        node* result = parse_prefix();
+        result = apply_qualifiers(qualifiers, count, result);
+        if (result && ref_qualifier != node_kind::name) {
+            result = make(ref_qualifier, result);
+        }
+        if (!result || !consume('E')) {
+            return nullptr;
+        }
+        return result;
+    }
+
+    // Components of the nested name up to the closing E. Each prefix is a substitution candidate.
+    node* parse_prefix() noexcept {
+        node* result = nullptr;
+        for (;;) {
+            const char c = peek();
+            node_kind combine = node_kind::qualified_name;
+            node* component = nullptr;
+
+            if (is_digit(c) || c == 'U') {
+                component = parse_unqualified_name();
+            } else if (c == 'S') {
+                component = parse_substitution();
+            } else if (c == 'I') {
+                if (!result) {
+                    return fail(parse_error::invalid);
+                }
+                combine = node_kind::template_name;
+                component = parse_template_args();
+            } else if (c == 'E') {
+                return (result ? result : fail(parse_error::invalid));
+            } else if (c == 'M') {
+                // Initializer scope of a lambda
+                if (!result) {
+                    return fail(parse_error::invalid);
+                }
+                ++p_;
+                continue;
+            } else if (c == 'D' || c == 'T' || c == 'C' || c == 'L' || is_lower(c)) {
+                // decltype, destructors, template parameters, constructors, internal names, operators
+                return fail(parse_error::unsupported);
+            } else {
+                return fail(parse_error::invalid);
+            }
+
+            if (!component) {
+                return nullptr;
+            }
+            result = (result ? make(combine, result, component) : component);
+            if (!result) {
+                return nullptr;
+            }
+            if (c != 'S' && peek() != 'E' && !add_substitution(result)) {
+                return nullptr;
+            }
+        }
+    }
+
+    // <unqualified-name> [<abi-tags>]
+    node* parse_unqualified_name() noexcept {
+        node* result = nullptr;
+        const char c = peek();
+        if (is_digit(c)) {
+            result = parse_source_name();
+        } else if (c == 'U' && peek_next() == 't') {
+            result = parse_unnamed_type();
+        } else if (c == 'U' && peek_next() == 'l') {
+            result = parse_lambda();
+        } else if (c == 'U' || c == 'C' || c == 'D' || c == 'L' || is_lower(c)) {
+            return fail(parse_error::unsupported);
+        } else {
+            return fail(parse_error::invalid);
+        }
+
+        while (result && peek() == 'B') {
+            ++p_;
+            node* const tag = parse_source_name();
+            result = (tag ? make(node_kind::tagged_name, result, tag) : nullptr);
+        }
+        return result;
+    }
+
+    // <number> <identifier>
+    node* parse_source_name() noexcept {
+        std::size_t len = 0;
+        if (!parse_number(len)) {
+            return nullptr;
+        }
+        if (len == 0 || len > static_cast<std::size_t>(end_ - p_)) {
+            return fail(parse_error::invalid);
+        }
+
+        const char* const name = p_;
+        p_ += len;
+
+        static const char anonymous_prefix[] = "_GLOBAL_";
+        static BOOST_CONSTEXPR_OR_CONST std::size_t anonymous_prefix_len = sizeof(anonymous_prefix) - 1;
+        if (len >= anonymous_prefix_len + 2 && !std::memcmp(name, anonymous_prefix, anonymous_prefix_len)) {
+            const char separator = name[anonymous_prefix_len];
+            if ((separator == '.' || separator == '_' || separator == '$') && name[anonymous_prefix_len + 1] == 'N') {
+                static const char anonymous_namespace[] = "(anonymous namespace)";
+                return make_string(node_kind::name, anonymous_namespace, sizeof(anonymous_namespace) - 1);
+            }
+        }
+        return make_string(node_kind::name, name, len);
+    }
+
+    // Ut [<number>] _
+    node* parse_unnamed_type() noexcept {
+        p_ += 2;
+        std::size_t number = 0;
+        if (!parse_compact_number(number)) {
+            return nullptr;
+        }
+        node* const result = make(node_kind::unnamed_type);
+        if (!result) {
+            return nullptr;
+        }
+        result->len = number;
+        return (add_substitution(result) ? result : nullptr);
+    }
+
+    // Ul <parameter types> E [<number>] _
+    node* parse_lambda() noexcept {
+        p_ += 2;
+        node* const parameters = parse_parameters();
+        if (!parameters || !consume('E')) {
+            return nullptr;
+        }
+        std::size_t number = 0;
+        if (!parse_compact_number(number)) {
+            return nullptr;
+        }
+        node* const result = make(node_kind::lambda, nullptr, parameters);
+        if (result) {
+            result->len = number;
+        }
+        return result;
+    }
+
+    // S_, S <seq-id> _ or one of the abbreviations of the standard names
+    node* parse_substitution() noexcept {
+        if (!consume('S')) {
+            return nullptr;
+        }
+
+        char c = peek();
+        if (c == '_' || is_digit(c) || is_upper(c)) {
+            std::size_t id = 0;
+            if (c != '_') {
+                do {
+                    if (id > max_substitutions) {
+                        return fail(parse_error::invalid);
+                    }
+                    if (is_digit(c)) {
+                        id = id * 36 + static_cast<std::size_t>(c - '0');
+                    } else if (is_upper(c)) {
+                        id = id * 36 + static_cast<std::size_t>(c - 'A') + 10;
+                    } else {
+                        return fail(parse_error::invalid);
+                    }
+                    ++p_;
+                    c = peek();
+                } while (c != '_');
+                ++id;
+            }
+            ++p_;
+
+            if (id >= substitutions_used_) {
+                return fail(parse_error::invalid);
+            }
+            return substitutions_[id];
+        }
+
+        const char* name = nullptr;
+        switch (c) {
+        case 't': name = "std"; break;
+        case 'a': name = "std::allocator"; break;
+        case 'b': name = "std::basic_string"; break;
+        case 's': name = "std::string"; break;
+        case 'i': name = "std::istream"; break;
+        case 'o': name = "std::ostream"; break;
+        case 'd': name = "std::iostream"; break;
+        default: return fail(parse_error::invalid);
+        }
+        ++p_;
+
+        node* result = make_string(node_kind::std_substitution, name, std::strlen(name));
+        if (!result || peek() != 'B') {
+            return result;
+        }
+
+        // Abbreviation with ABI tags is a substitution candidate
+        while (result && peek() == 'B') {
+            ++p_;
+            node* const tag = parse_source_name();
+            result = (tag ? make(node_kind::tagged_name, result, tag) : nullptr);
+        }
+        return (result && add_substitution(result) ? result : nullptr);
+    }
+
+    // I <template-arg>+ E, J <template-arg>* E
+    node* parse_template_args() noexcept {
+        const depth_guard guard(*this);
+        if (guard.exceeded()) {
+            return fail(parse_error::too_complex);
+        }
+        if (peek() != 'I' && peek() != 'J') {
+            return fail(parse_error::invalid);
+        }
+        ++p_;
+
+        if (peek() == 'E') {
+            // Empty argument pack
+            ++p_;
+            return make(node_kind::arglist);
+        }
+
+        node* head = nullptr;
+        node** tail = &head;
+        for (;;) {
+            node* const arg = parse_template_arg();
+            if (!arg) {
+                return nullptr;
+            }
+            *tail = make(node_kind::arglist, arg);
+            if (!*tail) {
+                return nullptr;
+            }
+            tail = &(*tail)->right;
+
+            if (peek() == 'E') {
+                ++p_;
+                return head;
+            }
+        }
+    }
+
+    node* parse_template_arg() noexcept {
+        switch (peek()) {
+        case 'X':
+            return fail(parse_error::unsupported);
+        case 'L':
+            return parse_expr_primary();
+        case 'I':
+        case 'J':
+            return parse_template_args();
+        default:
+            return parse_type();
+        }
+    }
+
+    // L <type> [n] <value> E
+    node* parse_expr_primary() noexcept {
+        if (!consume('L')) {
+            return nullptr;
+        }
+        if (peek() == '_' || peek() == 'Z') {
+            // Pointers and references to entities
+            return fail(parse_error::unsupported);
+        }
+
+        node* const type = parse_type();
+        if (!type) {
+            return nullptr;
+        }
+        if (type->kind == node_kind::builtin && peek() == 'E' && !std::strcmp(type->str, "decltype(nullptr)")) {
+            ++p_;
+            return type;
+        }
+
+        node_kind kind = node_kind::literal;
+        if (peek() == 'n') {
+            kind = node_kind::negative_literal;
+            ++p_;
+        }
+
+        const char* const value = p_;
+        while (peek() != 'E') {
+            if (peek() == '\0') {
+                return fail(parse_error::invalid);
+            }
+            ++p_;
+        }
+        if (p_ == value) {
+            return fail(parse_error::invalid);
+        }
+
+        node* const result = make_string(kind, value, static_cast<std::size_t>(p_ - value));
+        if (!result) {
+            return nullptr;
+        }
+        result->left = type;
+        ++p_;
+        return result;
+    }
+
+    // A [<dimension number>] _ <element type>
+    node* parse_array_type() noexcept {
+        if (!consume('A')) {
+            return nullptr;
+        }
+
+        node* dimension = nullptr;
+        if (is_digit(peek())) {
+            const char* const begin = p_;
+            while (is_digit(peek())) {
+                ++p_;
+            }
+            dimension = make_string(node_kind::name, begin, static_cast<std::size_t>(p_ - begin));
+            if (!dimension) {
+                return nullptr;
+            }
+        } else if (peek() != '_') {
+            // Dimension is an expression
+            return fail(parse_error::unsupported);
+        }
+
+        if (!consume('_')) {
+            return nullptr;
+        }
+        node* const element = parse_type();
+        return (element ? make(node_kind::array, dimension, element) : nullptr);
+    }
+
+    // M <class type> <member type>
+    node* parse_pointer_to_member_type() noexcept {
+        if (!consume('M')) {
+            return nullptr;
+        }
+        node* const class_type = parse_type();
+        node* const member_type = (class_type ? parse_type() : nullptr);
+        return (member_type ? make(node_kind::pointer_to_member, class_type, member_type) : nullptr);
+    }
+
+    // Z <function encoding> E <entity name> [<discriminator>]
+    node* parse_local_name() noexcept {
+        if (!consume('Z')) {
+            return nullptr;
+        }
+
+        node* const function = parse_encoding();
+        if (!function || !consume('E')) {
+            return nullptr;
+        }
+        if (peek() == 's' || peek() == 'd') {
+            // String literals and default arguments
+            return fail(parse_error::unsupported);
+        }
+
+        node* const name = parse_name();
+        if (!name) {
+            return nullptr;
+        }
+        if (name->kind != node_kind::lambda && name->kind != node_kind::unnamed_type && !parse_discriminator()) {
+            return nullptr;
+        }
+
+        if (function->kind == node_kind::typed_name && function->right->kind == node_kind::function) {
+            // Return type of the enclosing function is not printed
+            function->right->left = nullptr;
+        }
+        return make(node_kind::local_name, function, name);
+    }
+
+    // _ <digit> or __ <number> _
+    bool parse_discriminator() noexcept {
+        if (peek() != '_') {
+            return true;
+        }
+        ++p_;
+
+        bool two_underscores = false;
+        if (peek() == '_') {
+            two_underscores = true;
+            ++p_;
+        }
+
+        bool negative = false;
+        if (peek() == 'n') {
+            negative = true;
+            ++p_;
+        }
+
+        std::size_t number = 0;
+        if (!parse_number(number)) {
+            return false;
+        }
+        if (negative && number) {
+            fail(parse_error::invalid);
+            return false;
+        }
+        if (two_underscores && number >= 10) {
+            return consume('_');
+        }
+        return true;
+    }
+
+    // <name> [<bare-function-type>]
+    node* parse_encoding() noexcept {
+        if (peek() == 'G' || peek() == 'T') {
+            // Special names
+            return fail(parse_error::unsupported);
+        }
+
+        node* const name = parse_name();
+        if (!name) {
+            return nullptr;
+        }
+        if (peek() == '\0' || peek() == 'E') {
+            return name;
+        }
+        if (name->kind == node_kind::local_name) {
+            return fail(parse_error::unsupported);
+        }
+
+        node* const type = parse_bare_function_type(has_return_type(name));
+        return (type ? make(node_kind::typed_name, name, type) : nullptr);
+    }
+
+    static bool has_return_type(const node* name) noexcept {
+        while (is_function_qualifier(name->kind)) {
+            name = name->left;
+        }
+        if (name->kind == node_kind::local_name) {
+            return has_return_type(name->right);
+        }
+        // Constructors and conversion operators are not supported, all the templates have return types
+        return name->kind == node_kind::template_name;
+    }
+};
+
+// Writes up to `capacity` characters of the name into the buffer and counts the whole size of the name.
+class printer {
+public:
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_size = 1024 * 1024;
+
+    printer(char* buffer, std::size_t capacity) noexcept
+        : buffer_(buffer), capacity_(capacity), size_(0), last_('\0'), modifiers_(nullptr), failed_(false)
+    {}
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    bool failed() const noexcept {
+        return failed_;
+    }
+
+    void print(const node* n) noexcept {
+        if (failed_) {
+            return;
+        }
+        if (!n) {
+            failed_ = true;
+            return;
+        }
+
+        switch (n->kind) {
+        case node_kind::builtin:
+        case node_kind::name:
+        case node_kind::std_substitution:
+            append(n->str, n->len);
+            return;
+
+        case node_kind::vendor_type:
+            print(n->left);
+            return;
+
+        case node_kind::tagged_name:
+            print(n->left);
+            append("[abi:", 5);
+            print(n->right);
+            append(']');
+            return;
+
+        case node_kind::qualified_name:
+        case node_kind::local_name:
+            print(n->left);
+            append("::", 2);
+            print(n->right);
+            return;
+
+        case node_kind::template_name: {
+            // Modifiers do not apply to the template arguments
+            modifier* const hold = modifiers_;
+            modifiers_ = nullptr;
+            print(n->left);
+            if (last_ == '<') {
+                append(' ');
+            }
+            append('<');
+            print(n->right);
+            if (last_ == '>') {
+                append(' ');
+            }
+            append('>');
+            modifiers_ = hold;
+            return;
+        }
+
+        case node_kind::arglist:
+            if (n->left) {
+                print(n->left);
+            }
+            if (n->right) {
+                append(", ", 2);
+                const std::size_t size = size_;
+                print(n->right);
+                if (size_ == size) {
+                    // Empty argument pack. Just like in libiberty, the last printed character remains ' '
+                    size_ -= 2;
+                }
+            }
+            return;
+
+        case node_kind::lambda:
+            append("{lambda(", 8);
+            print(n->right);
+            append(")#", 2);
+            append_number(n->len + 1);
+            append('}');
+            return;
+
+        case node_kind::unnamed_type:
+            append("{unnamed type#", 14);
+            append_number(n->len + 1);
+            append('}');
+            return;
+
+        case node_kind::restrict_qualifier:
+        case node_kind::volatile_qualifier:
+        case node_kind::const_qualifier:
+            // Qualifiers of the arrays are pushed down to the element types, printing each qualifier once
+            for (modifier* m = modifiers_; m; m = m->next) {
+                if (!m->printed) {
+                    if (!is_cv_qualifier(m->mod->kind)) {
+                        break;
+                    }
+                    if (m->mod->kind == n->kind) {
+                        print(n->left);
+                        return;
+                    }
+                }
+            }
+            print_modifier(n, n->left);
+            return;
+
+        case node_kind::reference:
+        case node_kind::rvalue_reference:
+            // Reference collapsing: & & is &, && && is &&, & && is &, && & is &
+            if (n->left->kind == node_kind::reference || n->left->kind == n->kind) {
+                print_modifier(n->left, n->left->left);
+            } else if (n->left->kind == node_kind::rvalue_reference) {
+                print_modifier(n, n->left->left);
+            } else {
+                print_modifier(n, n->left);
+            }
+            return;
+
+        case node_kind::pointer:
+        case node_kind::restrict_this:
+        case node_kind::volatile_this:
+        case node_kind::const_this:
+        case node_kind::reference_this:
+        case node_kind::rvalue_reference_this:
+        case node_kind::noexcept_this:
+            print_modifier(n, n->left);
+            return;
+
+        case node_kind::pointer_to_member:
+            print_modifier(n, n->right);
+            return;
+
+        case node_kind::function:
+            print_function(n);
+            return;
+
+        case node_kind::array:
+            print_array(n);
+            return;
+
+        case node_kind::literal:
+        case node_kind::negative_literal:
+            print_literal(n);
+            return;
+
+        case node_kind::typed_name:
+            print_typed_name(n);
+            return;
+        }
+    }
+
+private:
+    // Modifiers are the pointers, references, qualifiers and other parts of the types that are
+    // printed after the inner type or inside the parentheses of the function and array types.
+    struct modifier {
+        modifier*   next;
+        const node* mod;
+        bool        printed;
+    };
+
+    char*       buffer_;
+    std::size_t capacity_;
+    std::size_t size_;
+    char        last_;
+    modifier*   modifiers_;
+    bool        failed_;
+
+    void append(char c) noexcept {
+        if (size_ < capacity_) {
+            buffer_[size_] = c;
+        }
+        ++size_;
+        last_ = c;
+    }
+
+    void append(const char* str, std::size_t len) noexcept {
+        if (size_ + len > max_size) {
+            failed_ = true;
+            return;
+        }
+        for (std::size_t i = 0; i < len; ++i) {
+            append(str[i]);
+        }
+    }
+
+    void append_number(std::size_t value) noexcept {
+        char digits[24];
+        std::size_t count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+
+        while (count) {
+            append(digits[--count]);
+        }
+    }
+
+    void print_modifier(const node* n, const node* inner) noexcept {
+        modifier m = {modifiers_, n, false};
+        modifiers_ = &m;
+        print(inner);
+        if (!m.printed) {
+            print_modifier_suffix(n);
+        }
+        modifiers_ = m.next;
+    }
+
+    void print_modifier_suffix(const node* n) noexcept {
+        switch (n->kind) {
+        case node_kind::restrict_qualifier:
+        case node_kind::restrict_this:
+            append(" restrict", 9);
+            return;
+        case node_kind::volatile_qualifier:
+        case node_kind::volatile_this:
+            append(" volatile", 9);
+            return;
+        case node_kind::const_qualifier:
+        case node_kind::const_this:
+            append(" const", 6);
+            return;
+        case node_kind::noexcept_this:
+            append(" noexcept", 9);
+            return;
+        case node_kind::pointer:
+            append('*');
+            return;
+        case node_kind::reference_this:
+            append(' ');
+            append('&');
+            return;
+        case node_kind::reference:
+            append('&');
+            return;
+        case node_kind::rvalue_reference_this:
+            append(' ');
+            append("&&", 2);
+            return;
+        case node_kind::rvalue_reference:
+            append("&&", 2);
+            return;
+        case node_kind::pointer_to_member:
+            if (last_ != '(') {
+                append(' ');
+            }
+            print(n->left);
+            append("::*", 3);
+            return;
+        default:
+            print(n);
+            return;
+        }
+    }
+
+    void print_modifier_list(modifier* mods, bool suffix) noexcept {
+        for (; mods && !failed_; mods = mods->next) {
+            if (mods->printed || (!suffix && is_function_qualifier(mods->mod->kind))) {
+                continue;
+            }
+
+            mods->printed = true;
+            if (mods->mod->kind == node_kind::function) {
+                print_function_type(mods->mod, mods->next);
+                return;
+            }
+            if (mods->mod->kind == node_kind::array) {
+                print_array_type(mods->mod, mods->next);
+                return;
+            }
+            print_modifier_suffix(mods->mod);
+        }
+    }
+
+    void print_function(const node* n) noexcept {
+        if (n->left) {
+            // Modifiers of the function are printed after the return type
+            modifier m = {modifiers_, n, false};
+            modifiers_ = &m;
+            print(n->left);
+            modifiers_ = m.next;
+            if (m.printed) {
+                return;
+            }
+            append(' ');
+        }
+        print_function_type(n, modifiers_);
+    }
+
+    void print_function_type(const node* n, modifier* mods) noexcept {
+        bool need_paren = false;
+        bool need_space = false;
+        for (modifier* m = mods; m && !m->printed; m = m->next) {
+            switch (m->mod->kind) {
+            case node_kind::pointer:
+            case node_kind::reference:
+            case node_kind::rvalue_reference:
+                need_paren = true;
+                break;
+            case node_kind::restrict_qualifier:
+            case node_kind::volatile_qualifier:
+            case node_kind::const_qualifier:
+            case node_kind::pointer_to_member:
+                need_space = true;
+                need_paren = true;
+                break;
+            default:
+                break;
+            }
+            if (need_paren) {
+                break;
+            }
+        }
+
+        if (need_paren) {
+            if (!need_space && last_ != '(' && last_ != '*') {
+                need_space = true;
+            }
+            if (need_space && last_ != ' ') {
+                append(' ');
+            }
+            append('(');
+        }
+
+        modifier* const hold = modifiers_;
+        modifiers_ = nullptr;
+        print_modifier_list(mods, false);
+        if (need_paren) {
+            append(')');
+        }
+
+        append('(');
+        if (n->right) {
+            print(n->right);
+        }
+        append(')');
+
+        print_modifier_list(mods, true);
+        modifiers_ = hold;
+    }
+
+    void print_array(const node* n) noexcept {
+        modifier* const hold = modifiers_;
+
+        // Qualifiers of the array apply to its elements
+        modifier mods[4];
+        mods[0].next = hold;
+        mods[0].mod = n;
+        mods[0].printed = false;
+        modifiers_ = &mods[0];
+
+        std::size_t count = 1;
+        for (modifier* m = hold; m && is_cv_qualifier(m->mod->kind); m = m->next) {
+            if (!m->printed) {
+                if (count == sizeof(mods) / sizeof(mods[0])) {
+                    failed_ = true;
+                    return;
+                }
+                mods[count] = *m;
+                mods[count].next = modifiers_;
+                modifiers_ = &mods[count];
+                m->printed = true;
+                ++count;
+            }
+        }
+
+        print(n->right);
+        modifiers_ = hold;
+        if (mods[0].printed) {
+            return;
+        }
+
+        while (count > 1) {
+            --count;
+            print_modifier_suffix(mods[count].mod);
+        }
+        print_array_type(n, modifiers_);
+    }
+
+    void print_array_type(const node* n, modifier* mods) noexcept {
+        bool need_space = true;
+        if (mods) {
+            bool need_paren = false;
+            for (modifier* m = mods; m; m = m->next) {
+                if (!m->printed) {
+                    if (m->mod->kind == node_kind::array) {
+                        need_space = false;
+                    } else {
+                        need_paren = true;
+                    }
+                    break;
+                }
+            }
+
+            if (need_paren) {
+                append(" (", 2);
+            }
+            print_modifier_list(mods, false);
+            if (need_paren) {
+                append(')');
+            }
+        }
+
+        if (need_space) {
+            append(' ');
+        }
+        append('[');
+        if (n->left) {
+            print(n->left);
+        }
+        append(']');
+    }
+
+    void print_literal(const node* n) noexcept {
+        const bool negative = (n->kind == node_kind::negative_literal);
+        const literal_format format = (n->left->kind == node_kind::builtin ? n->left->format : literal_format::cast);
+        switch (format) {
+        case literal_format::int_:
+        case literal_format::unsigned_:
+        case literal_format::long_:
+        case literal_format::unsigned_long:
+        case literal_format::long_long:
+        case literal_format::unsigned_long_long:
+            if (negative) {
+                append('-');
+            }
+            append(n->str, n->len);
+            switch (format) {
+            case literal_format::unsigned_: append('u'); break;
+            case literal_format::long_: append('l'); break;
+            case literal_format::unsigned_long: append("ul", 2); break;
+            case literal_format::long_long: append("ll", 2); break;
+            case literal_format::unsigned_long_long: append("ull", 3); break;
+            default: break;
+            }
+            return;
+
+        case literal_format::bool_:
+            if (n->len == 1 && !negative && (n->str[0] == '0' || n->str[0] == '1')) {
+                if (n->str[0] == '0') {
+                    append("false", 5);
+                } else {
+                    append("true", 4);
+                }
+                return;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        append('(');
+        print(n->left);
+        append(')');
+        if (negative) {
+            append('-');
+        }
+        if (format == literal_format::float_) {
+            append('[');
+        }
+        append(n->str, n->len);
+        if (format == literal_format::float_) {
+            append(']');
+        }
+    }
+
+    void print_typed_name(const node* n) noexcept {
+        modifier* const hold = modifiers_;
+        modifiers_ = nullptr;
+
+        // Name and the qualifiers of `this` are printed by the function type
+        modifier mods[4];
+        std::size_t count = 0;
+        for (const node* name = n->left; ; name = name->left) {
+            if (count == sizeof(mods) / sizeof(mods[0])) {
+                failed_ = true;
+                return;
+            }
+            mods[count].next = modifiers_;
+            mods[count].mod = name;
+            mods[count].printed = false;
+            modifiers_ = &mods[count];
+            ++count;
+
+            if (!is_function_qualifier(name->kind)) {
+                break;
+            }
+        }
+
+        print(n->right);
+        while (count > 0) {
+            --count;
+            if (!mods[count].printed) {
+                append(' ');
+                print_modifier_suffix(mods[count].mod);
+            }
+        }
+        modifiers_ = hold;
+    }
+};
+
+}}}} // namespace boost::typeindex::detail::itanium
+
+#endif // BOOST_TYPE_INDEX_DETAIL_ITANIUM_DEMANGLE_HPP
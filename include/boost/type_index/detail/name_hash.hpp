@@ -0,0 +1,115 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_NAME_HASH_HPP
+#define BOOST_TYPE_INDEX_DETAIL_NAME_HASH_HPP
+
+/// \file name_hash.hpp
+/// \brief Contains hash function for type names that could be computed at compile time and at runtime.
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+/// @cond
+#if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) \
+    || defined(_MSC_VER)
+#define BOOST_TYPE_INDEX_DETAIL_LITTLE_ENDIAN
+#endif
+/// @endcond
+
+namespace boost { namespace typeindex { namespace detail {
+
+    // The hash processes 8 bytes per step. Bytes are combined into the words in little endian
+    // order on all the platforms, so the same name has the same hash in every process and the
+    // hashes computed at compile time are equal to the hashes computed at runtime.
+
+    constexpr std::uint64_t name_hash_rotl(std::uint64_t v, unsigned int r) noexcept {
+        return (v << r) | (v >> (64 - r));
+    }
+
+    constexpr std::uint64_t name_hash_step(std::uint64_t hash, std::uint64_t word) noexcept {
+        return detail::name_hash_rotl(
+            hash ^ (detail::name_hash_rotl(word * 0x87c37b91114253d5ULL, 31) * 0x4cf5ad432745937fULL),
+            27
+        ) * 5 + 0x52dce729;
+    }
+
+    constexpr std::uint64_t name_hash_xorshift(std::uint64_t v) noexcept {
+        return v ^ (v >> 33);
+    }
+
+    constexpr std::uint64_t name_hash_finalize(std::uint64_t hash) noexcept {
+        return detail::name_hash_xorshift(
+            detail::name_hash_xorshift(detail::name_hash_xorshift(hash) * 0xff51afd7ed558ccdULL) * 0xc4ceb9fe1a85ec53ULL
+        );
+    }
+
+    constexpr std::uint64_t name_hash_seed(std::size_t size) noexcept {
+        return 0x9e3779b97f4a7c15ULL ^ (static_cast<std::uint64_t>(size) * 0x165667b19e3779f9ULL);
+    }
+
+    BOOST_CXX14_CONSTEXPR inline std::uint64_t name_hash_load_tail(const char* data, std::size_t size) noexcept {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            word |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+        }
+
+        return word;
+    }
+
+    inline std::uint64_t name_hash_load(const char* data) noexcept {
+#ifdef BOOST_TYPE_INDEX_DETAIL_LITTLE_ENDIAN
+        std::uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        return word;
+#else
+        return detail::name_hash_load_tail(data, 8);
+#endif
+    }
+
+    /// Hash of a [data, data + size) range, usable at compile time.
+    BOOST_CXX14_CONSTEXPR inline std::uint64_t constexpr_name_hash(const char* data, std::size_t size) noexcept {
+        std::uint64_t hash = detail::name_hash_seed(size);
+        for (; size >= 8; size -= 8, data += 8) {
+            hash = detail::name_hash_step(hash, detail::name_hash_load_tail(data, 8));
+        }
+        if (size) {
+            hash = detail::name_hash_step(hash, detail::name_hash_load_tail(data, size));
+        }
+
+        return detail::name_hash_finalize(hash);
+    }
+
+    /// Hash of a [data, data + size) range. Same as constexpr_name_hash, but loads whole words.
+    inline std::uint64_t name_hash(const char* data, std::size_t size) noexcept {
+        std::uint64_t hash = detail::name_hash_seed(size);
+        for (; size >= 8; size -= 8, data += 8) {
+            hash = detail::name_hash_step(hash, detail::name_hash_load(data));
+        }
+        if (size) {
+            hash = detail::name_hash_step(hash, detail::name_hash_load_tail(data, size));
+        }
+
+        return detail::name_hash_finalize(hash);
+    }
+
+    inline std::uint64_t name_hash(const char* name) noexcept {
+        return detail::name_hash(name, std::strlen(name));
+    }
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_NAME_HASH_HPP
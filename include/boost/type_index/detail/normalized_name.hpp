@@ -0,0 +1,576 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_NORMALIZED_NAME_HPP
+#define BOOST_TYPE_INDEX_DETAIL_NORMALIZED_NAME_HPP
+
+/// \file normalized_name.hpp
+/// \brief Contains the algorithm that makes the normalized_name() from the compact_name().
+/// Not intended for inclusion from user's code.
+
+#include <boost/type_index/detail/compact_name.hpp>
+
+#include <cstddef>
+#include <string>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+    BOOST_CXX14_CONSTEXPR inline std::size_t normalize_ident_size(const char* begin, const char* end) noexcept {
+        std::size_t size = 0;
+        while (begin + size != end && compact_name_is_ident(begin[size])) {
+            ++size;
+        }
+        return size;
+    }
+
+    /// Words of the builtin integral and floating point types
+    struct normalize_builtin_words {
+        unsigned unsigned_;
+        unsigned signed_;
+        unsigned short_;
+        unsigned long_;
+        unsigned char_;
+        unsigned double_;
+        unsigned int128_;
+    };
+
+    // Adds the word to the words, returns false if it is not a part of a builtin type name
+    BOOST_CXX14_CONSTEXPR inline bool normalize_add_builtin_word(normalize_builtin_words& words, const char* begin, const char* end) noexcept {
+        if (compact_name_equal(begin, end, "unsigned")) {
+            ++words.unsigned_;
+        } else if (compact_name_equal(begin, end, "signed")) {
+            ++words.signed_;
+        } else if (compact_name_equal(begin, end, "short") || compact_name_equal(begin, end, "__int16")) {
+            ++words.short_;
+        } else if (compact_name_equal(begin, end, "long")) {
+            ++words.long_;
+        } else if (compact_name_equal(begin, end, "__int64")) {
+            words.long_ += 2;
+        } else if (compact_name_equal(begin, end, "char") || compact_name_equal(begin, end, "__int8")) {
+            ++words.char_;
+        } else if (compact_name_equal(begin, end, "double")) {
+            ++words.double_;
+        } else if (compact_name_equal(begin, end, "__int128")) {
+            ++words.int128_;
+        } else if (!compact_name_equal(begin, end, "int") && !compact_name_equal(begin, end, "__int32")) {
+            return false;
+        }
+        return true;
+    }
+
+    BOOST_CXX14_CONSTEXPR inline bool normalize_is_builtin_word(const char* begin, const char* end) noexcept {
+        normalize_builtin_words words{};
+        return detail::normalize_add_builtin_word(words, begin, end);
+    }
+
+    /// Writes the canonical spelling of type names into the buffer: builtin types are spelled as
+    /// `unsigned long` instead of `long unsigned int`, anonymous namespaces as `(anonymous namespace)`,
+    /// class keywords of MSVC are removed, integral template arguments are written as plain decimal
+    /// numbers, spaces are placed in the same way as in `std::vector<void (*)(int)[3], A<B>> const&`.
+    class normalize_spelling_builder {
+    public:
+        BOOST_CXX14_CONSTEXPR normalize_spelling_builder(const char* begin, const char* end, char* out, std::size_t capacity) noexcept
+            : begin_(begin)
+            , in_(begin)
+            , end_(end)
+            , out_(out)
+            , capacity_(capacity)
+            , pos_(0)
+            , depth_(0)
+            , brackets_{}
+            , failed_(false)
+        {}
+
+        // Returns false if the output does not fit into the buffer or the brackets are too deep
+        BOOST_CXX14_CONSTEXPR bool build() noexcept {
+            while (in_ != end_ && !failed_) {
+                step();
+            }
+            return !failed_;
+        }
+
+        BOOST_CXX14_CONSTEXPR std::size_t size() const noexcept {
+            return pos_;
+        }
+
+    private:
+        static constexpr std::size_t max_depth = 64;
+
+        BOOST_CXX14_CONSTEXPR void put(char c) noexcept {
+            if (pos_ == capacity_) {
+                failed_ = true;
+                return;
+            }
+            out_[pos_++] = c;
+        }
+
+        BOOST_CXX14_CONSTEXPR void put(const char* literal) noexcept {
+            for (; *literal; ++literal) {
+                put(*literal);
+            }
+        }
+
+        BOOST_CXX14_CONSTEXPR char last() const noexcept {
+            return pos_ ? out_[pos_ - 1] : '\0';
+        }
+
+        BOOST_CXX14_CONSTEXPR bool in_template_args() const noexcept {
+            return depth_ && depth_ <= max_depth && brackets_[depth_ - 1] == '<';
+        }
+
+        BOOST_CXX14_CONSTEXPR void step() noexcept {
+            const char c = *in_;
+            if (c == ' ') {
+                spaces();
+            } else if (c == '{' && compact_name_starts_with(in_, end_, "{anonymous}")) {
+                put("(anonymous namespace)");
+                in_ += 11;
+            } else if (c == '`' && compact_name_starts_with(in_, end_, "`anonymous namespace'")) {
+                put("(anonymous namespace)");
+                in_ += 21;
+            } else if (c == '<' || c == '(' || c == '[' || c == '{') {
+                if (depth_ < max_depth) {
+                    brackets_[depth_] = c;
+                }
+                ++depth_;
+                put(c);
+                ++in_;
+                if (c == '<') {
+                    literal_arg();
+                }
+            } else if (c == '>' || c == ')' || c == ']' || c == '}') {
+                if (depth_) {
+                    --depth_;
+                }
+                put(c);
+                ++in_;
+            } else if (c == ',') {
+                put(',');
+                ++in_;
+                while (in_ != end_ && *in_ == ' ') {
+                    ++in_;
+                }
+                put(' ');
+                if (in_template_args()) {
+                    literal_arg();
+                }
+            } else if (compact_name_is_ident(c) && (in_ == begin_ || !compact_name_is_ident(in_[-1]))) {
+                word();
+            } else {
+                put(c);
+                ++in_;
+            }
+        }
+
+        BOOST_CXX14_CONSTEXPR void spaces() noexcept {
+            while (in_ != end_ && *in_ == ' ') {
+                ++in_;
+            }
+            if (in_ == end_ || !pos_) {
+                return;
+            }
+
+            const char prev = last();
+            const char next = *in_;
+            if (prev == '<' || prev == '(' || prev == '[' || prev == '{' || prev == ' ') {
+                return;
+            }
+            if (next == ',' || next == '>' || next == ')' || next == ']' || next == '}' || next == '(') {
+                return;
+            }
+            if (next == '*' || next == '&' || (next == '[' && prev == ')')) {
+                return;
+            }
+            put(' ');
+        }
+
+        BOOST_CXX14_CONSTEXPR void word() noexcept {
+            const std::size_t size = normalize_ident_size(in_, end_);
+            const char* const word_end = in_ + size;
+
+            // MSVC prefixes the class names with their kind
+            if (word_end != end_ && *word_end == ' ' && (
+                compact_name_equal(in_, word_end, "class") || compact_name_equal(in_, word_end, "struct")
+                || compact_name_equal(in_, word_end, "enum") || compact_name_equal(in_, word_end, "union")))
+            {
+                in_ = word_end + 1;
+                return;
+            }
+
+            if (compact_name_starts_with(in_, end_, "decltype(nullptr)") || compact_name_starts_with(in_, end_, "decltype (nullptr)")) {
+                put("std::nullptr_t");
+                in_ += (in_[8] == '(' ? 17 : 18);
+                return;
+            }
+
+            normalize_builtin_words words{};
+            if (!normalize_add_builtin_word(words, in_, word_end)) {
+                for (; in_ != word_end; ++in_) {
+                    put(*in_);
+                }
+                return;
+            }
+
+            in_ = word_end;
+            while (in_ != end_ && *in_ == ' ') {
+                const char* const next = in_ + 1;
+                const char* const next_end = next + normalize_ident_size(next, end_);
+                if (next == next_end || !normalize_add_builtin_word(words, next, next_end)) {
+                    break;
+                }
+                in_ = next_end;
+            }
+            builtin(words);
+        }
+
+        BOOST_CXX14_CONSTEXPR void builtin(const normalize_builtin_words& words) noexcept {
+            if (words.char_) {
+                put(words.unsigned_ ? "unsigned char" : (words.signed_ ? "signed char" : "char"));
+            } else if (words.double_) {
+                put(words.long_ ? "long double" : "double");
+            } else if (words.int128_) {
+                put(words.unsigned_ ? "unsigned __int128" : "__int128");
+            } else {
+                if (words.unsigned_) {
+                    put("unsigned ");
+                }
+                put(words.short_ ? "short" : (words.long_ >= 2 ? "long long" : (words.long_ ? "long" : "int")));
+            }
+        }
+
+        // Writes the integral literal template argument as a decimal number: `5u`, `(short)5` become `5`
+        // and 'a' becomes `97`. Leaves the input as is if the argument is not such literal.
+        BOOST_CXX14_CONSTEXPR void literal_arg() noexcept {
+            const char* it = in_;
+            compact_name_skip_spaces(it, end_);
+
+            if (it != end_ && *it == '(') {
+                ++it;
+                bool builtin_cast = false;
+                for (;;) {
+                    const char* const word_end = it + normalize_ident_size(it, end_);
+                    if (it == word_end) {
+                        break;
+                    }
+                    if (!normalize_is_builtin_word(it, word_end) && !compact_name_equal(it, word_end, "wchar_t")
+                        && !compact_name_equal(it, word_end, "char8_t") && !compact_name_equal(it, word_end, "char16_t")
+                        && !compact_name_equal(it, word_end, "char32_t"))
+                    {
+                        return;
+                    }
+                    builtin_cast = true;
+                    it = word_end;
+                    if (it != end_ && *it == ' ') {
+                        ++it;
+                    }
+                }
+                if (!builtin_cast || it == end_ || *it != ')') {
+                    return;
+                }
+                ++it;
+            }
+
+            const bool negative = (it != end_ && *it == '-');
+            if (negative) {
+                ++it;
+            }
+
+            unsigned long long value = 0;
+            const char* digits = it;
+            const char* digits_end = it;
+            if (it != end_ && *it >= '0' && *it <= '9') {
+                while (it != end_ && *it >= '0' && *it <= '9') {
+                    ++it;
+                }
+                digits_end = it;
+                while (it != end_ && (*it == 'u' || *it == 'U' || *it == 'l' || *it == 'L')) {
+                    ++it;
+                }
+            } else {
+                if (it != end_ && (*it == 'L' || *it == 'U')) {
+                    ++it;
+                } else if (compact_name_starts_with(it, end_, "u8")) {
+                    it += 2;
+                } else if (it != end_ && *it == 'u') {
+                    ++it;
+                }
+                if (!char_literal(it, value)) {
+                    return;
+                }
+            }
+
+            compact_name_skip_spaces(it, end_);
+            if (it == end_ || (*it != ',' && *it != '>')) {
+                return;
+            }
+
+            if (negative) {
+                put('-');
+            }
+            if (digits != digits_end) {
+                for (; digits != digits_end; ++digits) {
+                    put(*digits);
+                }
+            } else {
+                number(value);
+            }
+            in_ = it;
+        }
+
+        BOOST_CXX14_CONSTEXPR bool char_literal(const char*& it, unsigned long long& value) const noexcept {
+            if (it == end_ || *it != '\'') {
+                return false;
+            }
+            ++it;
+            if (it == end_) {
+                return false;
+            }
+
+            if (*it != '\\') {
+                value = static_cast<unsigned char>(*it);
+                ++it;
+            } else {
+                ++it;
+                if (it == end_) {
+                    return false;
+                }
+                const char c = *it;
+                ++it;
+                if (c >= '0' && c <= '7') {
+                    value = static_cast<unsigned long long>(c - '0');
+                    for (int i = 0; i < 2 && it != end_ && *it >= '0' && *it <= '7'; ++i, ++it) {
+                        value = value * 8 + static_cast<unsigned long long>(*it - '0');
+                    }
+                } else if (c == 'x') {
+                    value = 0;
+                    for (; it != end_ && *it != '\''; ++it) {
+                        const char h = *it;
+                        const unsigned digit = (h >= '0' && h <= '9') ? static_cast<unsigned>(h - '0')
+                            : (h >= 'a' && h <= 'f') ? static_cast<unsigned>(h - 'a' + 10)
+                            : (h >= 'A' && h <= 'F') ? static_cast<unsigned>(h - 'A' + 10)
+                            : 16u;
+                        if (digit == 16u) {
+                            return false;
+                        }
+                        value = value * 16 + digit;
+                    }
+                } else {
+                    switch (c) {
+                    case 'a': value = 7; break;
+                    case 'b': value = 8; break;
+                    case 't': value = 9; break;
+                    case 'n': value = 10; break;
+                    case 'v': value = 11; break;
+                    case 'f': value = 12; break;
+                    case 'r': value = 13; break;
+                    case '\\': case '\'': case '"': case '?': value = static_cast<unsigned char>(c); break;
+                    default: return false;
+                    }
+                }
+            }
+
+            if (it == end_ || *it != '\'') {
+                return false;
+            }
+            ++it;
+            return true;
+        }
+
+        BOOST_CXX14_CONSTEXPR void number(unsigned long long value) noexcept {
+            char digits[20] = {};
+            std::size_t size = 0;
+            do {
+                digits[size++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value);
+
+            while (size) {
+                put(digits[--size]);
+            }
+        }
+
+        const char*         begin_;
+        const char*         in_;
+        const char*         end_;
+        char*               out_;
+        std::size_t         capacity_;
+        std::size_t         pos_;
+        std::size_t         depth_;
+        char                brackets_[max_depth];
+        bool                failed_;
+    };
+
+    /// Moves the leading `const` and `volatile` to the right of the type: `const int*` becomes `int const*`.
+    /// Expects the input in the canonical spelling. Output has the same size as the input.
+    class normalize_cv_builder {
+    public:
+        BOOST_CXX14_CONSTEXPR normalize_cv_builder(const char* begin, const char* end, char* out) noexcept
+            : in_(begin)
+            , end_(end)
+            , out_(out)
+            , capacity_(static_cast<std::size_t>(end - begin))
+            , pos_(0)
+            , failed_(false)
+        {}
+
+        // Returns false if the name has unbalanced brackets
+        BOOST_CXX14_CONSTEXPR bool build() noexcept {
+            sequence('\0');
+            return !failed_ && in_ == end_;
+        }
+
+    private:
+        BOOST_CXX14_CONSTEXPR void put(char c) noexcept {
+            if (pos_ == capacity_) {
+                failed_ = true;
+                return;
+            }
+            out_[pos_++] = c;
+        }
+
+        BOOST_CXX14_CONSTEXPR void copy() noexcept {
+            put(*in_);
+            ++in_;
+        }
+
+        BOOST_CXX14_CONSTEXPR void sequence(char close) noexcept {
+            type_start();
+            while (in_ != end_ && !failed_) {
+                const char c = *in_;
+                if (c == close) {
+                    return;
+                }
+
+                if (c == '<' || c == '(') {
+                    nested(c == '<' ? '>' : ')');
+                } else if (c == ',') {
+                    copy();
+                    while (in_ != end_ && *in_ == ' ') {
+                        copy();
+                    }
+                    type_start();
+                } else {
+                    copy();
+                }
+            }
+        }
+
+        BOOST_CXX14_CONSTEXPR void nested(char close) noexcept {
+            copy();
+            sequence(close);
+            if (in_ == end_) {
+                failed_ = true;
+                return;
+            }
+            copy();
+        }
+
+        BOOST_CXX14_CONSTEXPR void type_start() noexcept {
+            bool is_const = false;
+            bool is_volatile = false;
+            for (;;) {
+                if (compact_name_starts_with(in_, end_, "const ")) {
+                    is_const = true;
+                    in_ += 6;
+                } else if (compact_name_starts_with(in_, end_, "volatile ")) {
+                    is_volatile = true;
+                    in_ += 9;
+                } else {
+                    break;
+                }
+            }
+            if (!is_const && !is_volatile) {
+                return;
+            }
+
+            // Copying the type name, that may consist of multiple words only if it is a builtin type
+            while (in_ != end_ && !failed_) {
+                if (compact_name_starts_with(in_, end_, "(anonymous namespace)")) {
+                    for (std::size_t i = 0; i < 21; ++i) {
+                        copy();
+                    }
+                } else if (compact_name_is_ident(*in_)) {
+                    const char* const word_end = in_ + normalize_ident_size(in_, end_);
+                    const bool builtin = normalize_is_builtin_word(in_, word_end);
+                    while (in_ != word_end) {
+                        copy();
+                    }
+                    if (builtin && in_ != end_ && *in_ == ' ') {
+                        const char* const next_end = in_ + 1 + normalize_ident_size(in_ + 1, end_);
+                        if (normalize_is_builtin_word(in_ + 1, next_end)) {
+                            copy();
+                        }
+                    }
+                } else if (*in_ == ':') {
+                    copy();
+                } else if (*in_ == '<') {
+                    nested('>');
+                } else {
+                    break;
+                }
+            }
+
+            if (is_const) {
+                put(' ');
+                put('c'); put('o'); put('n'); put('s'); put('t');
+            }
+            if (is_volatile) {
+                put(' ');
+                put('v'); put('o'); put('l'); put('a'); put('t'); put('i'); put('l'); put('e');
+            }
+        }
+
+        const char*         in_;
+        const char*         end_;
+        char*               out_;
+        std::size_t         capacity_;
+        std::size_t         pos_;
+        bool                failed_;
+    };
+
+    /// Size of the buffers for the normalize_type_name()
+    BOOST_CXX14_CONSTEXPR inline std::size_t normalized_name_capacity(std::size_t size) noexcept {
+        return size * 2 + 1;
+    }
+
+    /// Writes the normalized form of the compact name [name, name + size) into the `out`. Both `buffer` and
+    /// `out` must have normalized_name_capacity(size) characters.
+    /// Returns the size of the zero terminated result.
+    BOOST_CXX14_CONSTEXPR inline std::size_t normalize_type_name(const char* name, std::size_t size, char* buffer, char* out) noexcept {
+        normalize_spelling_builder spelling(name, name + size, buffer, normalized_name_capacity(size) - 1);
+        std::size_t result = size;
+        if (spelling.build()) {
+            result = spelling.size();
+            normalize_cv_builder cv(buffer, buffer + result, out);
+            if (cv.build()) {
+                out[result] = '\0';
+                return result;
+            }
+        }
+
+        for (std::size_t i = 0; i < size; ++i) {
+            out[i] = name[i];
+        }
+        out[size] = '\0';
+        return size;
+    }
+
+    inline std::string normalize_type_name(const std::string& compact_name) {
+        std::string buffer(detail::normalized_name_capacity(compact_name.size()), '\0');
+        std::string result(buffer.size(), '\0');
+        result.resize(detail::normalize_type_name(compact_name.data(), compact_name.size(), &buffer[0], &result[0]));
+        return result;
+    }
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_NORMALIZED_NAME_HPP
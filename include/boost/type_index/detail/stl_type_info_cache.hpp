@@ -0,0 +1,111 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_STL_TYPE_INFO_CACHE_HPP
+#define BOOST_TYPE_INDEX_DETAIL_STL_TYPE_INFO_CACHE_HPP
+
+/// \file stl_type_info_cache.hpp
+/// \brief Contains a process wide cache of the information computed from type_info.
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+/// Information about a single type. Entries are immutable after the construction and
+/// are never destroyed, so pointers to them and to their members stay valid forever.
+template <class TypeInfo, class Value>
+struct stl_type_info_cache_entry {
+    const TypeInfo*                     key;
+    Value                               value;
+    const stl_type_info_cache_entry*    next;
+};
+
+/// Lock-free hash table from the address of type_info to the Value computed from it.
+/// Each Value type has its own table.
+///
+/// Lookups of already cached types do not lock and do not write to the shared memory.
+/// New entries are prepended to the bucket lists with compare-and-swap.
+template <class TypeInfo, class Value>
+class stl_type_info_cache {
+public:
+    typedef stl_type_info_cache_entry<TypeInfo, Value> entry_t;
+
+    static stl_type_info_cache& instance() noexcept {
+        // Zero initialized at compile time and has a trivial destructor, so it is usable from
+        // constructors and destructors of other static objects. Entries are never freed.
+        static stl_type_info_cache cache;
+        return cache;
+    }
+
+    /// Returns entry for the type_info or nullptr if memory allocation failed.
+    /// Calls `factory(key)` to compute the Value if the type is not in the cache yet.
+    /// Throws only if the factory throws.
+    template <class Factory>
+    const entry_t* find(const TypeInfo& key, Factory factory) {
+        std::atomic<const entry_t*>& bucket = buckets_[bucket_index(key)];
+
+        const entry_t* head = bucket.load(std::memory_order_acquire);
+        if (const entry_t* e = find_in_list(head, nullptr, key)) {
+            return e;
+        }
+
+        entry_t* new_entry = new (std::nothrow) entry_t{&key, factory(key), head};
+        if (!new_entry) {
+            return nullptr;
+        }
+
+        while (!bucket.compare_exchange_weak(head, new_entry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            // Some other thread may have inserted the same key
+            if (const entry_t* e = find_in_list(head, new_entry->next, key)) {
+                delete new_entry;
+                return e;
+            }
+            new_entry->next = head;
+        }
+
+        return new_entry;
+    }
+
+private:
+    static constexpr std::size_t buckets_count = 1024;
+
+    stl_type_info_cache() = default;
+
+    static std::size_t bucket_index(const TypeInfo& key) noexcept {
+        // type_info objects are aligned and usually are placed close to each other
+        std::uintptr_t v = reinterpret_cast<std::uintptr_t>(&key) >> 3;
+        v ^= (v >> 10) ^ (v >> 20);
+        return static_cast<std::size_t>(v) & (buckets_count - 1);
+    }
+
+    static const entry_t* find_in_list(const entry_t* it, const entry_t* end, const TypeInfo& key) noexcept {
+        for (; it != end; it = it->next) {
+            if (it->key == &key) {
+                return it;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::atomic<const entry_t*> buckets_[buckets_count];
+};
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_STL_TYPE_INFO_CACHE_HPP
@@ -0,0 +1,68 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_DETAIL_STRIP_CVR_SAVER_HPP
+#define BOOST_TYPE_INDEX_DETAIL_STRIP_CVR_SAVER_HPP
+
+/// \file strip_cvr_saver.hpp
+/// \brief Contains removal of the cvr_saver wrapper from the demangled names.
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+// Removes the boost::typeindex::detail::cvr_saver<> wrapper that type_id_with_cvr<T>() adds to the types with qualifiers.
+// Name must be zero terminated.
+inline void strip_cvr_saver(const char*& begin, const char*& end) noexcept {
+    static const char cvr_saver_name[] = "boost::typeindex::detail::cvr_saver<";
+    static BOOST_CONSTEXPR_OR_CONST std::size_t cvr_saver_name_len = sizeof(cvr_saver_name) - 1;
+
+    if (static_cast<std::size_t>(end - begin) <= cvr_saver_name_len) {
+        return;
+    }
+
+    const char* b = std::strstr(begin, cvr_saver_name);
+    if (!b) {
+        return;
+    }
+    b += cvr_saver_name_len;
+
+    // Trim leading spaces
+    while (*b == ' ') {         // the string is zero terminated, we won't exceed the buffer size
+        ++ b;
+    }
+
+    // Skip the closing angle bracket
+    const char* e = end - 1;
+    while (e > b && *e != '>') {
+        -- e;
+    }
+
+    // Trim trailing spaces
+    while (e > b && *(e - 1) == ' ') {
+        -- e;
+    }
+
+    if (b < e) {
+        // Parsing seems to have succeeded, the type name is not empty
+        begin = b;
+        end = e;
+    }
+}
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_DETAIL_STRIP_CVR_SAVER_HPP
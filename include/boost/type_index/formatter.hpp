@@ -0,0 +1,204 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_FORMATTER_HPP
+#define BOOST_TYPE_INDEX_FORMATTER_HPP
+
+/// \file formatter.hpp
+/// \brief Contains std::formatter and fmt::formatter specializations for the classes derived from type_index_facade.
+///
+/// std::formatter is provided if the Standard Library has <format>. fmt::formatter is provided if
+/// <fmt/format.h> is included before this header.
+///
+/// Format specification is empty or consists of a single presentation type:
+/// - `{}` or `{:p}` - pretty_name()
+/// - `{:r}` - raw_name()
+/// - `{:c}` - compact_name()
+/// - `{:s}` - short_name()
+/// - `{:n}` - normalized_name()
+/// - `{:f}` - fingerprint() as 16 lowercase hexadecimal digits
+///
+/// Names of ctti_type_index and stl_type_index are written from the static or cached storage,
+/// without allocating memory after the first use of the name for the type.
+
+#include <boost/type_index/type_index_facade.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_format) && (__cpp_lib_format >= 201907L)
+#  include <format>
+#  define BOOST_TYPE_INDEX_DETAIL_HAS_STD_FORMAT
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+/// @cond
+namespace boost { namespace typeindex { namespace detail {
+
+    template <class T, class = void>
+    struct is_type_index: std::false_type {};
+
+    template <class T>
+    struct is_type_index<T, typename std::enable_if<
+        std::is_base_of<type_index_facade<T, typename T::type_info_t>, T>::value
+    >::type>: std::true_type {};
+
+    // Parses the format specification [begin, end). Returns the position of the closing brace,
+    // `valid` is set to false if the specification is invalid.
+    template <class It>
+    constexpr It parse_type_index_format(It begin, It end, char& presentation, bool& valid) noexcept {
+        presentation = 'p';
+        valid = true;
+        if (begin == end || *begin == '}') {
+            return begin;
+        }
+
+        switch (*begin) {
+        case 'p': case 'r': case 'c': case 's': case 'n': case 'f':
+            presentation = *begin;
+            ++begin;
+            break;
+        default:
+            valid = false;
+            return begin;
+        }
+
+        valid = (begin == end || *begin == '}');
+        return begin;
+    }
+
+    // Views are used if the TypeIndex provides them, otherwise the names are copied into std::string
+    template <class TypeIndex>
+    auto format_compact_name(const TypeIndex& value, int) -> decltype(value.compact_name_view()) {
+        return value.compact_name_view();
+    }
+
+    template <class TypeIndex>
+    std::string format_compact_name(const TypeIndex& value, long) {
+        return value.compact_name();
+    }
+
+    template <class TypeIndex>
+    auto format_short_name(const TypeIndex& value, int) -> decltype(value.short_name_view()) {
+        return value.short_name_view();
+    }
+
+    template <class TypeIndex>
+    std::string format_short_name(const TypeIndex& value, long) {
+        return value.short_name();
+    }
+
+    template <class TypeIndex>
+    auto format_normalized_name(const TypeIndex& value, int) -> decltype(value.normalized_name_view()) {
+        return value.normalized_name_view();
+    }
+
+    template <class TypeIndex>
+    std::string format_normalized_name(const TypeIndex& value, long) {
+        return value.normalized_name();
+    }
+
+    template <class OutputIt>
+    OutputIt format_copy(std::string_view name, OutputIt out) {
+        for (const char c : name) {
+            *out = c;
+            ++out;
+        }
+        return out;
+    }
+
+    template <class TypeIndex, class OutputIt>
+    OutputIt format_type_index(const TypeIndex& value, char presentation, OutputIt out) {
+        switch (presentation) {
+        case 'r':
+            return detail::format_copy(value.raw_name_view(), out);
+        case 'c':
+            return detail::format_copy(detail::format_compact_name(value, 0), out);
+        case 's':
+            return detail::format_copy(detail::format_short_name(value, 0), out);
+        case 'n':
+            return detail::format_copy(detail::format_normalized_name(value, 0), out);
+        case 'f': {
+            const std::uint64_t fingerprint = value.fingerprint();
+            char digits[16] = {};
+            for (std::size_t i = 0; i < 16; ++i) {
+                digits[i] = "0123456789abcdef"[(fingerprint >> (60 - 4 * i)) & 0xf];
+            }
+            return detail::format_copy(std::string_view(digits, 16), out);
+        }
+        default:
+            return detail::format_copy(detail::pretty_name_or_view(value), out);
+        }
+    }
+
+}}} // namespace boost::typeindex::detail
+/// @endcond
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_HAS_STD_FORMAT) || defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
+/// Formats TypeIndex values with std::format(). See the description of boost/type_index/formatter.hpp for the format specification.
+template <class TypeIndex>
+    requires boost::typeindex::detail::is_type_index<TypeIndex>::value
+struct std::formatter<TypeIndex, char> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        bool valid = true;
+        const auto it = boost::typeindex::detail::parse_type_index_format(ctx.begin(), ctx.end(), presentation_, valid);
+        if (!valid) {
+            throw std::format_error("Invalid format specification for a type_index");
+        }
+        return it;
+    }
+
+    template <class FormatContext>
+    auto format(const TypeIndex& value, FormatContext& ctx) const {
+        return boost::typeindex::detail::format_type_index(value, presentation_, ctx.out());
+    }
+
+private:
+    char presentation_ = 'p';
+};
+#endif
+
+#if defined(FMT_VERSION) || defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
+/// Formats TypeIndex values with fmt::format(). See the description of boost/type_index/formatter.hpp for the format specification.
+template <class TypeIndex>
+struct fmt::formatter<TypeIndex, char, typename std::enable_if<boost::typeindex::detail::is_type_index<TypeIndex>::value>::type> {
+    constexpr auto parse(fmt::format_parse_context& ctx) -> decltype(ctx.begin()) {
+        bool valid = true;
+        const auto it = boost::typeindex::detail::parse_type_index_format(ctx.begin(), ctx.end(), presentation_, valid);
+        if (!valid) {
+            throw fmt::format_error("Invalid format specification for a type_index");
+        }
+        return it;
+    }
+
+    template <class FormatContext>
+    auto format(const TypeIndex& value, FormatContext& ctx) const -> decltype(ctx.out()) {
+        return boost::typeindex::detail::format_type_index(value, presentation_, ctx.out());
+    }
+
+private:
+    char presentation_ = 'p';
+};
+#endif
+
+#endif // BOOST_NO_CXX17_HDR_STRING_VIEW
+
+#endif // BOOST_TYPE_INDEX_FORMATTER_HPP
@@ -0,0 +1,295 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RESOLVE_NAMES_HPP
+#define BOOST_TYPE_INDEX_RESOLVE_NAMES_HPP
+
+/// \file resolve_names.hpp
+/// \brief Contains boost::typeindex::resolve_names() function that gets the pretty names of many types at once.
+
+#include <boost/type_index.hpp>
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && defined(BOOST_HAS_THREADS)
+#include <exception>
+#include <system_error>
+#include <thread>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+/// @cond
+template <class TypeIndex>
+class basic_resolved_names;
+
+template <class TypeIndex>
+void resolve_names(const TypeIndex* first, std::size_t count, basic_resolved_names<TypeIndex>& output, std::size_t threads = 0);
+/// @endcond
+
+/// \class basic_resolved_names
+/// Pretty names of a sequence of types, filled by the resolve_names().
+///
+/// Equal types share the name. All the names are stored in a single arena one after another,
+/// so the container does not allocate memory per name. Filling the same container again
+/// reuses the already allocated memory.
+///
+/// \tparam TypeIndex ctti_type_index, stl_type_index or other class derived from type_index_facade.
+template <class TypeIndex>
+class basic_resolved_names {
+public:
+    /// \return Count of the resolved types.
+    std::size_t size() const noexcept {
+        return indexes_.size();
+    }
+
+    /// \return Count of the different names, that is the count of the different types.
+    std::size_t unique_size() const noexcept {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    /// \return Zero terminated pretty name of the i-th resolved type.
+    const char* c_str(std::size_t i) const noexcept {
+        BOOST_ASSERT(i < size());
+        return arena_.c_str() + offsets_[indexes_[i]];
+    }
+
+    /// \return Length of the pretty name of the i-th resolved type.
+    std::size_t name_size(std::size_t i) const noexcept {
+        BOOST_ASSERT(i < size());
+        return offsets_[indexes_[i] + 1] - offsets_[indexes_[i]] - 1;
+    }
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW) || defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
+    /// \return View of the pretty name of the i-th resolved type.
+    /// Available only if std::string_view is provided by the Standard Library.
+    std::string_view operator[](std::size_t i) const noexcept {
+        return std::string_view(c_str(i), name_size(i));
+    }
+#endif
+
+    /// \return Number of the unique name of the i-th resolved type. Numbers are given in the order of first appearance.
+    std::size_t unique_index(std::size_t i) const noexcept {
+        BOOST_ASSERT(i < size());
+        return indexes_[i];
+    }
+
+    /// \return All the unique names, each one is followed by a zero.
+    const std::string& arena() const noexcept {
+        return arena_;
+    }
+
+    /// \return unique_size() + 1 offsets in the arena(). The k-th unique name starts at offsets()[k] and
+    /// its terminating zero is at offsets()[k + 1] - 1.
+    const std::vector<std::size_t>& offsets() const noexcept {
+        return offsets_;
+    }
+
+private:
+    /// @cond
+    template <class T>
+    friend void resolve_names(const T* first, std::size_t count, basic_resolved_names<T>& output, std::size_t threads);
+
+    std::string                 arena_;     // unique names, each one is zero terminated
+    std::vector<std::size_t>    offsets_;   // offsets_[k] is the position of the k-th unique name in the arena_
+    std::vector<std::size_t>    indexes_;   // indexes_[i] is the number of the unique name of the i-th resolved type
+    /// @endcond
+};
+
+/// @cond
+namespace detail {
+
+    template <class TypeIndex>
+    struct resolve_names_hash {
+        std::size_t operator()(const TypeIndex& value) const noexcept {
+            // Unlike the fingerprint(), hash_code() does not require the pretty name
+            return value.hash_code();
+        }
+    };
+
+    // Names of the types [first, last) are appended to the arena, each one is zero terminated.
+    // offsets[i] receives the position of the name of first[i] in the arena.
+    template <class TypeIndex>
+    void resolve_names_chunk(const TypeIndex* first, const TypeIndex* last, std::string& arena, std::size_t* offsets) {
+        for (; first != last; ++first, ++offsets) {
+            *offsets = arena.size();
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+            const auto& name = detail::pretty_name_or_view(*first);
+            arena.append(name.data(), name.size());
+#else
+            arena += first->pretty_name();
+#endif
+            arena += '\0';
+        }
+    }
+
+    // Less types are resolved faster in the current thread than a new thread is started.
+    BOOST_CONSTEXPR_OR_CONST std::size_t resolve_names_min_per_thread = 256;
+
+} // namespace detail
+/// @endcond
+
+/// Gets the pretty names of types [first, first + count) into the output.
+///
+/// Equal types are resolved once. If there are many different types, they are split between
+/// up to `threads` threads. With stl_type_index this makes the first demangling of each type
+/// parallel, already demangled names are just copied from the process wide cache.
+///
+/// \code
+/// std::vector<boost::typeindex::type_index> types = collect_types();
+/// boost::typeindex::resolved_names names;
+/// boost::typeindex::resolve_names(types.data(), types.size(), names);
+/// for (std::size_t i = 0; i < names.size(); ++i) {
+///     std::puts(names.c_str(i));
+/// }
+/// \endcode
+///
+/// \param first Pointer to the first type.
+/// \param count Count of types.
+/// \param output Container for the names. Its previous content is replaced.
+/// \param threads Maximal count of threads to use, including the current one. Zero means std::thread::hardware_concurrency().
+/// \throw Nothing if all the TypeIndex::pretty_name() calls do not throw, otherwise the first exception is rethrown
+/// and the output is left in a valid but unspecified state.
+template <class TypeIndex>
+void resolve_names(const TypeIndex* first, std::size_t count, basic_resolved_names<TypeIndex>& output, std::size_t threads) {
+    output.arena_.clear();
+    output.offsets_.clear();
+    output.indexes_.clear();
+    output.indexes_.reserve(count);
+
+    std::vector<TypeIndex> uniques;
+    {
+        std::unordered_map<TypeIndex, std::size_t, detail::resolve_names_hash<TypeIndex> > numbers;
+        numbers.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto inserted = numbers.emplace(first[i], uniques.size());
+            if (inserted.second) {
+                uniques.push_back(first[i]);
+            }
+            output.indexes_.push_back(inserted.first->second);
+        }
+    }
+
+    const std::size_t size = uniques.size();
+    output.offsets_.resize(size + 1);
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && defined(BOOST_HAS_THREADS)
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads > size / detail::resolve_names_min_per_thread) {
+        threads = size / detail::resolve_names_min_per_thread;
+    }
+
+    if (threads > 1) {
+        // Chunk t is [bounds[t], bounds[t + 1]). Chunk 0 is resolved by the current thread right into the
+        // output, other threads fill their own arenas that are appended to the output afterwards.
+        const std::size_t chunk = (size + threads - 1) / threads;
+        std::vector<std::size_t> bounds(threads + 1);
+        for (std::size_t t = 0; t <= threads; ++t) {
+            bounds[t] = (t * chunk < size ? t * chunk : size);
+        }
+
+        std::vector<std::string> arenas(threads);
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+
+        for (std::size_t t = 1; t < threads; ++t) {
+            const TypeIndex* const chunk_first = uniques.data() + bounds[t];
+            const TypeIndex* const chunk_last = uniques.data() + bounds[t + 1];
+            std::size_t* const offsets = output.offsets_.data() + bounds[t];
+            std::string* const arena = &arenas[t];
+            std::exception_ptr* const error = &errors[t];
+
+            try {
+                workers.emplace_back([chunk_first, chunk_last, arena, offsets, error]() {
+                    try {
+                        detail::resolve_names_chunk(chunk_first, chunk_last, *arena, offsets);
+                    } catch (...) {
+                        *error = std::current_exception();
+                    }
+                });
+            } catch (const std::system_error&) {
+                // The system is out of threads. Already started workers are joined below as usual and
+                // the chunks of the workers that were not started are resolved by the current thread.
+                break;
+            }
+        }
+
+        try {
+            detail::resolve_names_chunk(uniques.data(), uniques.data() + bounds[1], output.arena_, output.offsets_.data());
+            for (std::size_t t = workers.size() + 1; t < threads; ++t) {
+                detail::resolve_names_chunk(
+                    uniques.data() + bounds[t], uniques.data() + bounds[t + 1], arenas[t], output.offsets_.data() + bounds[t]
+                );
+            }
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+
+        for (std::size_t t = 0; t < workers.size(); ++t) {
+            workers[t].join();
+        }
+        for (std::size_t t = 0; t < threads; ++t) {
+            if (errors[t]) {
+                std::rethrow_exception(errors[t]);
+            }
+        }
+
+        std::size_t total = output.arena_.size();
+        for (std::size_t t = 1; t < threads; ++t) {
+            total += arenas[t].size();
+        }
+        output.arena_.reserve(total);
+
+        for (std::size_t t = 1; t < threads; ++t) {
+            const std::size_t shift = output.arena_.size();
+            for (std::size_t i = bounds[t]; i < bounds[t + 1]; ++i) {
+                output.offsets_[i] += shift;
+            }
+            output.arena_ += arenas[t];
+        }
+    } else
+#else
+    (void)threads;
+#endif
+    {
+        detail::resolve_names_chunk(uniques.data(), uniques.data() + size, output.arena_, output.offsets_.data());
+    }
+
+    output.offsets_.back() = output.arena_.size();
+}
+
+/// Gets the pretty names of the types from a contiguous range into the output.
+/// Range could be std::vector<TypeIndex>, std::array<TypeIndex, N>, std::span<const TypeIndex> and so forth.
+/// See resolve_names(const TypeIndex*, std::size_t, basic_resolved_names<TypeIndex>&, std::size_t) for more info.
+template <class Range, class TypeIndex>
+void resolve_names(const Range& types, basic_resolved_names<TypeIndex>& output, std::size_t threads = 0) {
+    const TypeIndex* const first = types.data();
+    boost::typeindex::resolve_names(first, static_cast<std::size_t>(types.size()), output, threads);
+}
+
+/// Pretty names of boost::typeindex::type_index values. See basic_resolved_names for more info.
+typedef basic_resolved_names<type_index> resolved_names;
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_RESOLVE_NAMES_HPP
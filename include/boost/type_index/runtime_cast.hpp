@@ -20,6 +20,9 @@
 #include <boost/type_index/runtime_cast/register_runtime_class.hpp>
 #include <boost/type_index/runtime_cast/pointer_cast.hpp>
 #include <boost/type_index/runtime_cast/reference_cast.hpp>
+#include <boost/type_index/runtime_cast/filter_cast.hpp>
+#include <boost/type_index/runtime_cast/std_unique_ptr_cast.hpp>
+#include <boost/type_index/runtime_cast/boost_intrusive_ptr_cast.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -0,0 +1,65 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_BOOST_INTRUSIVE_PTR_CAST_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_BOOST_INTRUSIVE_PTR_CAST_HPP
+
+/// \file boost_intrusive_ptr_cast.hpp
+/// \brief Contains the overload of boost::typeindex::runtime_pointer_cast for
+/// boost::intrusive_ptr types.
+
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+
+#include <type_traits>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost {
+    template<class T> class intrusive_ptr;
+}
+
+namespace boost { namespace typeindex {
+
+/// \brief Creates a new instance of boost::intrusive_ptr whose stored pointer is obtained from u's
+/// stored pointer using a runtime_cast.
+///
+/// The new intrusive_ptr will add a reference to the object, except that it is empty if the runtime_cast
+/// performed by runtime_pointer_cast returns a null pointer.
+/// \tparam T The desired target type to return a pointer of.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a boost::intrusive_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns boost::intrusive_ptr<T>();
+template<typename T, typename U>
+boost::intrusive_ptr<T> runtime_pointer_cast(boost::intrusive_ptr<U> const& u) {
+    return boost::intrusive_ptr<T>(detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>()));
+}
+
+/// \brief Creates a new instance of boost::intrusive_ptr that takes the reference from u and whose stored pointer
+/// is obtained from u's stored pointer using a runtime_cast.
+///
+/// On success u becomes empty and the reference count is not modified. If the runtime_cast performed by
+/// runtime_pointer_cast returns a null pointer, u is left intact and an empty intrusive_ptr is returned.
+/// \tparam T The desired target type to return a pointer of.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a boost::intrusive_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns boost::intrusive_ptr<T>();
+template<typename T, typename U>
+boost::intrusive_ptr<T> runtime_pointer_cast(boost::intrusive_ptr<U>&& u) noexcept {
+    T* value = detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>());
+    if(value)
+        u.detach();
+    return boost::intrusive_ptr<T>(value, false);
+}
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_BOOST_INTRUSIVE_PTR_CAST_HPP
@@ -16,6 +16,7 @@
 #include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
 
 #include <type_traits>
+#include <utility>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -45,6 +46,24 @@ boost::shared_ptr<T> runtime_pointer_cast(boost::shared_ptr<U> const& u) {
     return boost::shared_ptr<T>();
 }
 
+/// \brief Creates a new instance of boost::shared_ptr that takes the ownership from u and whose stored pointer
+/// is obtained from u's stored pointer using a runtime_cast.
+///
+/// On success u becomes empty and the reference count is not modified. If the runtime_cast performed by
+/// runtime_pointer_cast returns a null pointer, u is left intact and an empty shared_ptr is returned.
+/// \tparam T The desired target type to return a pointer of.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a boost::shared_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns boost::shared_ptr<T>();
+template<typename T, typename U>
+boost::shared_ptr<T> runtime_pointer_cast(boost::shared_ptr<U>&& u) noexcept {
+    T* value = detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>());
+    if(value)
+        return boost::shared_ptr<T>(std::move(u), value);
+    return boost::shared_ptr<T>();
+}
+
 }} // namespace boost::typeindex
 
 #endif // BOOST_TYPE_INDEX_RUNTIME_CAST_BOOST_SHARED_PTR_CAST_HPP
@@ -0,0 +1,122 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CAST_CACHE_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CAST_CACHE_HPP
+
+/// \file runtime_cast_cache.hpp
+/// \brief Contains a process wide cache of the runtime_cast results.
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+/// Result of casting a class that implements the runtime_cast to the requested type
+struct runtime_cast_result {
+    enum kind_t {
+        not_found,      // class has no base of the requested type
+        static_offset,  // requested base is at the `offset` from the class, for any object
+        dynamic_offset  // requested base is reachable only through a virtual base, offset depends on the object
+    };
+
+    kind_t          kind;
+    std::ptrdiff_t  offset;
+};
+
+/// Cached result for a pair of (class that overrides the boost_type_index_find_instance_, requested type).
+/// Entries are immutable after the construction and are never destroyed.
+struct runtime_cast_cache_entry {
+    const void*                     class_key;
+    const void*                     type_key;
+    runtime_cast_result             result;
+    const runtime_cast_cache_entry* next;
+};
+
+/// Lock-free hash table from the pair of (address of the per class key, address of the type_info of the requested type)
+/// to the runtime_cast_result.
+///
+/// Lookups of already cached pairs do not lock and do not write to the shared memory.
+/// New entries are prepended to the bucket lists with compare-and-swap. Equal types with different type_info
+/// addresses just get their own entries.
+class runtime_cast_cache {
+public:
+    static runtime_cast_cache& instance() noexcept {
+        // Zero initialized at compile time and has a trivial destructor, so it is usable from
+        // constructors and destructors of other static objects. Entries are never freed.
+        static runtime_cast_cache cache;
+        return cache;
+    }
+
+    /// Returns the cached result or nullptr if the pair is not in the cache yet.
+    const runtime_cast_result* find(const void* class_key, const void* type_key) const noexcept {
+        const runtime_cast_cache_entry* const e = find_in_list(
+            buckets_[bucket_index(class_key, type_key)].load(std::memory_order_acquire), nullptr, class_key, type_key
+        );
+        return e ? &e->result : nullptr;
+    }
+
+    /// Adds the result to the cache. Does nothing if memory allocation failed.
+    void insert(const void* class_key, const void* type_key, runtime_cast_result result) noexcept {
+        std::atomic<const runtime_cast_cache_entry*>& bucket = buckets_[bucket_index(class_key, type_key)];
+
+        const runtime_cast_cache_entry* head = bucket.load(std::memory_order_acquire);
+        runtime_cast_cache_entry* new_entry = new (std::nothrow) runtime_cast_cache_entry{class_key, type_key, result, head};
+        if (!new_entry) {
+            return;
+        }
+
+        while (!bucket.compare_exchange_weak(head, new_entry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            // Some other thread may have inserted the same pair
+            if (find_in_list(head, new_entry->next, class_key, type_key)) {
+                delete new_entry;
+                return;
+            }
+            new_entry->next = head;
+        }
+    }
+
+private:
+    static constexpr std::size_t buckets_count = 1024;
+
+    runtime_cast_cache() = default;
+
+    static std::size_t bucket_index(const void* class_key, const void* type_key) noexcept {
+        const std::uintptr_t c = reinterpret_cast<std::uintptr_t>(class_key) >> 3;
+        std::uintptr_t v = (reinterpret_cast<std::uintptr_t>(type_key) >> 3) * 31 + c;
+        v ^= (v >> 10) ^ (v >> 20);
+        return static_cast<std::size_t>(v) & (buckets_count - 1);
+    }
+
+    static const runtime_cast_cache_entry* find_in_list(const runtime_cast_cache_entry* it, const runtime_cast_cache_entry* end,
+                                                        const void* class_key, const void* type_key) noexcept
+    {
+        for (; it != end; it = it->next) {
+            if (it->class_key == class_key && it->type_key == type_key) {
+                return it;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::atomic<const runtime_cast_cache_entry*> buckets_[buckets_count];
+};
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CAST_CACHE_HPP
@@ -18,6 +18,7 @@
 /// desire opt in functionality instead of enabling it system wide.
 
 #include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_class_table.hpp>
 
 #include <type_traits>
 
@@ -39,16 +40,58 @@ T const* runtime_cast_impl(U const* u, std::integral_constant<bool, true>) noexc
     return u;
 }
 
+#if defined(__cpp_lib_is_final)
+template <class T>
+struct is_final_class: std::is_final<T> {};
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+template <class T>
+struct is_final_class: std::integral_constant<bool, __is_final(T)> {};
+#else
+template <class T>
+struct is_final_class: std::false_type {};
+#endif
+
+// Returns the instance of T if T is the most derived class of *u that implements the runtime_cast
+template<typename T, typename U>
+const void* runtime_cast_find_exact(U const* u) noexcept {
+    return u->boost_type_index_find_exact_instance_(boost::typeindex::type_id<T>());
+}
+
+// Object is an instance of the final T only if T is its most derived class, so no search through the bases is required
+template<typename T, typename U>
+const void* runtime_cast_find(U const* u, std::integral_constant<bool, true> /*is_final*/) noexcept {
+    return boost::typeindex::detail::runtime_cast_find_exact<T>(u);
+}
+
+template<typename T, typename U>
+const void* runtime_cast_find(U const* u, std::integral_constant<bool, false> /*is_final*/) noexcept {
+#if defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_BASE_TABLE)
+    return boost::typeindex::detail::find_instance_in_table<T>(u);
+#else
+    return u->boost_type_index_find_instance_(boost::typeindex::type_id<T>());
+#endif
+}
+
 template<typename T, typename U>
 T* runtime_cast_impl(U* u, std::integral_constant<bool, false>) noexcept {
     return const_cast<T*>(static_cast<T const*>(
-        u->boost_type_index_find_instance_(boost::typeindex::type_id<T>())
+        boost::typeindex::detail::runtime_cast_find<T>(u, is_final_class<T>())
     ));
 }
 
 template<typename T, typename U>
 T const* runtime_cast_impl(U const* u, std::integral_constant<bool, false>) noexcept {
-    return static_cast<T const*>(u->boost_type_index_find_instance_(boost::typeindex::type_id<T>()));
+    return static_cast<T const*>(boost::typeindex::detail::runtime_cast_find<T>(u, is_final_class<T>()));
+}
+
+template<typename T, typename U>
+T* exact_runtime_cast_impl(U* u) noexcept {
+    return const_cast<T*>(static_cast<T const*>(boost::typeindex::detail::runtime_cast_find_exact<T>(u)));
+}
+
+template<typename T, typename U>
+T const* exact_runtime_cast_impl(U const* u) noexcept {
+    return static_cast<T const*>(boost::typeindex::detail::runtime_cast_find_exact<T>(u));
 }
 
 } // namespace detail
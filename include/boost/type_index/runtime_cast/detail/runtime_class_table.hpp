@@ -0,0 +1,217 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CLASS_TABLE_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CLASS_TABLE_HPP
+
+/// \file runtime_class_table.hpp
+/// \brief Contains the compile time tables of all the bases of the classes that implement the runtime_cast.
+/// Not intended for inclusion from user's code.
+
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(BOOST_TYPE_INDEX_RUNTIME_CAST_BASE_TABLE) && !defined(BOOST_NO_CXX14_CONSTEXPR) && (!defined(_MSC_VER) || _MSC_VER > 1916)
+#define BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_BASE_TABLE
+#include <boost/type_index/ctti_type_index.hpp>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex { namespace detail {
+
+// Base is at the same offset in all the Derived objects if it is a non-virtual base of Derived
+template <class Base, class Derived, class = void>
+struct is_static_base_of: std::false_type {};
+
+template <class Base, class Derived>
+struct is_static_base_of<Base, Derived, decltype(static_cast<void>(static_cast<const Derived*>(std::declval<const Base*>())))>
+    : std::true_type
+{};
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_BASE_TABLE)
+
+/// Direct bases of a class, as they were passed to BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST
+template <class... Bases>
+struct runtime_class_bases {};
+
+/// Chain of direct bases from the class to one of its transitive bases
+template <class... Path>
+struct runtime_base_path;
+
+template <class Last>
+struct runtime_base_path<Last> {
+    typedef Last first;
+    typedef Last type;
+    static constexpr bool is_static = true;
+
+    static const type* cast(const Last* p) noexcept {
+        return p;
+    }
+};
+
+template <class First, class Next, class... Rest>
+struct runtime_base_path<First, Next, Rest...> {
+    typedef First first;
+    typedef typename runtime_base_path<Next, Rest...>::type type;
+    static constexpr bool is_static = is_static_base_of<Next, First>::value && runtime_base_path<Next, Rest...>::is_static;
+
+    static const type* cast(const First* p) noexcept {
+        return runtime_base_path<Next, Rest...>::cast(p);
+    }
+};
+
+template <class... Paths>
+struct runtime_base_list {};
+
+template <class Left, class Right>
+struct runtime_base_list_join;
+
+template <class... Left, class... Right>
+struct runtime_base_list_join<runtime_base_list<Left...>, runtime_base_list<Right...> > {
+    typedef runtime_base_list<Left..., Right...> type;
+};
+
+template <class Derived, class Path>
+struct runtime_base_path_prepend;
+
+template <class Derived, class... Path>
+struct runtime_base_path_prepend<Derived, runtime_base_path<Path...> > {
+    typedef runtime_base_path<Derived, Path...> type;
+};
+
+template <class Derived, class List>
+struct runtime_base_list_prepend;
+
+template <class Derived, class... Paths>
+struct runtime_base_list_prepend<Derived, runtime_base_list<Paths...> > {
+    typedef runtime_base_list<typename runtime_base_path_prepend<Derived, Paths>::type...> type;
+};
+
+template <class Self, class Bases>
+struct runtime_base_flatten_bases;
+
+/// All the bases of Self and Self itself in the depth first order, the same as the order
+/// of the search in boost_type_index_find_instance_walk_
+template <class Self>
+struct runtime_base_flatten {
+    typedef typename runtime_base_list_join<
+        runtime_base_list<runtime_base_path<Self> >,
+        typename runtime_base_flatten_bases<Self, typename Self::boost_type_index_direct_bases_>::type
+    >::type type;
+};
+
+template <class Self>
+struct runtime_base_flatten_bases<Self, runtime_class_bases<> > {
+    typedef runtime_base_list<> type;
+};
+
+template <class Self, class Base, class... OtherBases>
+struct runtime_base_flatten_bases<Self, runtime_class_bases<Base, OtherBases...> > {
+    typedef typename runtime_base_list_join<
+        typename runtime_base_list_prepend<Self, typename runtime_base_flatten<Base>::type>::type,
+        typename runtime_base_flatten_bases<Self, runtime_class_bases<OtherBases...> >::type
+    >::type type;
+};
+
+template <class T, class... Paths>
+struct runtime_base_count: std::integral_constant<std::size_t, 0> {};
+
+template <class T, class Path, class... Paths>
+struct runtime_base_count<T, Path, Paths...>: std::integral_constant<std::size_t,
+    std::is_same<T, typename Path::type>::value + runtime_base_count<T, Paths...>::value
+> {};
+
+typedef const void* (*runtime_base_cast_t)(const void*);
+
+template <class Path>
+const void* runtime_base_cast(const void* self) noexcept {
+    return Path::cast(static_cast<const typename Path::first*>(self));
+}
+
+/// Bases of a class: fingerprints of the ctti_type_index of the bases are stored one after another, so that a search
+/// reads a few cache lines. Null cast means that the base is reachable through a virtual base or is ambiguous, and
+/// the search through the bases must be used for it.
+struct runtime_class_table {
+    std::size_t                 size;
+    const std::uint64_t*        fingerprints;
+    const ctti_type_index*      types;
+    const runtime_base_cast_t*  casts;
+};
+
+template <class Self, class List = typename runtime_base_flatten<Self>::type>
+struct runtime_class_table_holder;
+
+template <class Self, class... Paths>
+struct runtime_class_table_holder<Self, runtime_base_list<Paths...> > {
+    static constexpr std::uint64_t fingerprints[sizeof...(Paths)] = {
+        ctti_type_index::type_id<typename Paths::type>().fingerprint()...
+    };
+
+    static constexpr ctti_type_index types[sizeof...(Paths)] = {
+        ctti_type_index::type_id<typename Paths::type>()...
+    };
+
+    static constexpr runtime_base_cast_t casts[sizeof...(Paths)] = {
+        (Paths::is_static && runtime_base_count<typename Paths::type, Paths...>::value == 1
+            ? &detail::runtime_base_cast<Paths>
+            : nullptr)...
+    };
+
+    static constexpr runtime_class_table value = {sizeof...(Paths), fingerprints, types, casts};
+};
+
+template <class Self, class... Paths>
+constexpr std::uint64_t runtime_class_table_holder<Self, runtime_base_list<Paths...> >::fingerprints[sizeof...(Paths)];
+
+template <class Self, class... Paths>
+constexpr ctti_type_index runtime_class_table_holder<Self, runtime_base_list<Paths...> >::types[sizeof...(Paths)];
+
+template <class Self, class... Paths>
+constexpr runtime_base_cast_t runtime_class_table_holder<Self, runtime_base_list<Paths...> >::casts[sizeof...(Paths)];
+
+template <class Self, class... Paths>
+constexpr runtime_class_table runtime_class_table_holder<Self, runtime_base_list<Paths...> >::value;
+
+template <class Self>
+const runtime_class_table* runtime_class_table_of(const Self*) noexcept {
+    return &runtime_class_table_holder<Self>::value;
+}
+
+/// Returns the instance of T or nullptr if there's no such base. Calls the
+/// boost_type_index_find_instance_ for the virtual and ambiguous bases.
+template <class T, class U>
+const void* find_instance_in_table(const U* u) noexcept {
+    const void* self = nullptr;
+    const runtime_class_table& table = *u->boost_type_index_table_(self);
+
+    constexpr std::uint64_t fingerprint = ctti_type_index::type_id<T>().fingerprint();
+    for (std::size_t i = 0; i < table.size; ++i) {
+        if (table.fingerprints[i] != fingerprint || table.types[i] != ctti_type_index::type_id<T>()) {
+            continue;
+        }
+
+        return table.casts[i]
+            ? table.casts[i](self)
+            : u->boost_type_index_find_instance_(boost::typeindex::type_id<T>());
+    }
+
+    return nullptr;
+}
+
+#endif // defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_BASE_TABLE)
+
+}}} // namespace boost::typeindex::detail
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_DETAIL_RUNTIME_CLASS_TABLE_HPP
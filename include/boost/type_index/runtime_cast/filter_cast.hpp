@@ -0,0 +1,171 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_FILTER_CAST_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_FILTER_CAST_HPP
+
+/// \file filter_cast.hpp
+/// \brief Contains the function boost::typeindex::runtime_filter_cast that casts
+/// ranges of pointers.
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_cache.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+namespace detail {
+
+/// Results of casting to T for the most derived classes seen in a single runtime_filter_cast call.
+/// Keeps a few classes, which is enough for the typical ranges with objects of a few classes.
+///
+/// The classes are the final overriders of the runtime_cast functions, not the most derived classes: an unregistered
+/// most derived class may have different final overriders for different subobjects, and the result of runtime_cast
+/// depends on them. Offsets of the instances that are reachable only through virtual bases are searched for each object.
+template <class T>
+class runtime_filter_cache {
+public:
+    runtime_filter_cache() noexcept
+        : size_(0)
+        , next_(0)
+    {}
+
+    template <class U>
+    const void* cast(U const* u) noexcept {
+        const void* self = nullptr;
+        const void* const class_key = u->boost_type_index_runtime_class_key_(self);
+
+        const runtime_cast_result& result = find(u, class_key);
+        switch (result.kind) {
+        case runtime_cast_result::not_found: return nullptr;
+        case runtime_cast_result::static_offset: return static_cast<const char*>(self) + result.offset;
+        case runtime_cast_result::dynamic_offset: break;
+        }
+
+        return u->boost_type_index_find_instance_(boost::typeindex::type_id<T>());
+    }
+
+private:
+    static constexpr std::size_t capacity = 8;
+
+    struct entry {
+        const void*         class_key;
+        runtime_cast_result result;
+    };
+
+    template <class U>
+    const runtime_cast_result& find(U const* u, const void* class_key) noexcept {
+        // Scanning all the entries without early exits, so that the mixed classes in the range do not cause
+        // branch mispredictions
+        std::size_t found = capacity;
+        for (std::size_t i = 0; i < size_; ++i) {
+            found = (entries_[i].class_key == class_key ? i : found);
+        }
+
+        if (found == capacity) {
+            found = (size_ < capacity ? size_++ : next_++ % capacity);
+            entries_[found].class_key = class_key;
+            entries_[found].result = resolve(u, class_key);
+        }
+
+        return entries_[found].result;
+    }
+
+    // Does the usual cast once for the class, kind of the result is taken from the process wide cache
+    template <class U>
+    static runtime_cast_result resolve(U const* u, const void* class_key) noexcept {
+        const boost::typeindex::type_index idx = boost::typeindex::type_id<T>();
+        u->boost_type_index_find_instance_(idx);
+
+        const runtime_cast_result* cached = runtime_cast_cache::instance().find(class_key, &idx.type_info());
+        if (!cached) {
+            // Memory allocation failed, casting each object
+            const runtime_cast_result dynamic = {runtime_cast_result::dynamic_offset, 0};
+            return dynamic;
+        }
+
+        return *cached;
+    }
+
+    std::size_t size_;
+    std::size_t next_;
+    entry       entries_[capacity];
+};
+
+template <class T, class U>
+T* runtime_filter_cast_impl(U* u, runtime_filter_cache<T>&, std::integral_constant<bool, true>) noexcept {
+    return u;
+}
+
+template <class T, class U>
+T const* runtime_filter_cast_impl(U const* u, runtime_filter_cache<T>&, std::integral_constant<bool, true>) noexcept {
+    return u;
+}
+
+template <class T, class U>
+T* runtime_filter_cast_impl(U* u, runtime_filter_cache<T>& cache, std::integral_constant<bool, false>) noexcept {
+    return const_cast<T*>(static_cast<T const*>(cache.cast(u)));
+}
+
+template <class T, class U>
+T const* runtime_filter_cast_impl(U const* u, runtime_filter_cache<T>& cache, std::integral_constant<bool, false>) noexcept {
+    return static_cast<T const*>(cache.cast(u));
+}
+
+} // namespace detail
+
+/// \brief Safely converts a range of pointers to classes up, down, and sideways along the inheritance hierarchy
+/// and writes only the successfully converted pointers.
+///
+/// Searches for the target type once per most derived class that implements the runtime_cast, and reuses the result
+/// for all the other objects of that class. Null pointers in the range are skipped.
+///
+/// \b Example:
+/// \code
+/// std::vector<base*> objects = get_objects();
+/// std::vector<derived*> derived_objects;
+/// boost::typeindex::runtime_filter_cast<derived*>(objects.begin(), objects.end(), std::back_inserter(derived_objects));
+/// \endcode
+///
+/// \tparam T The desired target type. Like dynamic_cast, must be a pointer to complete class type.
+/// \param first, last Range of pointers to complete class types that implement the runtime_cast.
+/// \param out Output iterator that accepts T.
+/// \return Output iterator past the last written pointer. For each pointer in the range, in the same order,
+/// the same pointer as boost::typeindex::runtime_cast<T> returns is written if it is not nullptr.
+template <typename T, typename InputIterator, typename OutputIterator>
+OutputIterator runtime_filter_cast(InputIterator first, InputIterator last, OutputIterator out) {
+    typedef typename std::remove_cv<typename std::remove_pointer<T>::type>::type impl_type;
+    typedef typename std::decay<decltype(*first)>::type source_pointer;
+    typedef typename std::remove_cv<typename std::remove_pointer<source_pointer>::type>::type source_type;
+
+    detail::runtime_filter_cache<impl_type> cache;
+    for (; first != last; ++first) {
+        const source_pointer u = *first;
+        if (!u) {
+            continue;
+        }
+
+        if (T value = detail::runtime_filter_cast_impl<impl_type>(u, cache, std::is_base_of<impl_type, source_type>())) {
+            *out = value;
+            ++out;
+        }
+    }
+
+    return out;
+}
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_FILTER_CAST_HPP
@@ -68,6 +68,30 @@ T const* runtime_pointer_cast(U const* u) noexcept {
     return detail::runtime_cast_impl<T>(u, std::is_base_of<T, U>());
 }
 
+/// \brief Converts pointers to the class that is the exact dynamic type of the instance.
+/// \tparam T The desired target type. Must be a pointer to complete class type.
+/// \tparam U A complete class type of the source instance, u.
+/// \return If the most derived class of *u that implements the runtime_cast is the target class, returns a T
+/// that points to that instance. Otherwise returns nullptr, even if the target class is a base of the instance.
+/// Does a single type comparison without searching through the bases.
+template<typename T, typename U>
+T exact_runtime_cast(U* u) noexcept {
+    typedef typename std::remove_pointer<T>::type impl_type;
+    return detail::exact_runtime_cast_impl<impl_type>(u);
+}
+
+/// \brief Converts pointers to the class that is the exact dynamic type of the instance.
+/// \tparam T The desired target type. Must be a pointer to complete class type.
+/// \tparam U A complete class type of the source instance, u.
+/// \return If the most derived class of *u that implements the runtime_cast is the target class, returns a T
+/// that points to that instance. Otherwise returns nullptr, even if the target class is a base of the instance.
+/// Does a single type comparison without searching through the bases.
+template<typename T, typename U>
+T exact_runtime_cast(U const* u) noexcept {
+    typedef typename std::remove_pointer<T>::type impl_type;
+    return detail::exact_runtime_cast_impl<impl_type>(u);
+}
+
 }} // namespace boost::typeindex
 
 #endif // BOOST_TYPE_INDEX_RUNTIME_CAST_POINTER_CAST_HPP
@@ -60,6 +60,34 @@ typename std::add_lvalue_reference<const T>::type runtime_cast(U const& u) {
     return *value;
 }
 
+/// \brief Converts references to the class that is the exact dynamic type of the instance.
+/// \tparam T The desired target type. Must be a reference to complete class type.
+/// \tparam U A complete class type of the source instance, u.
+/// \return If the most derived class of u that implements the runtime_cast is the target class, returns a T
+/// that references that instance. Otherwise throws boost::typeindex::bad_runtime_cast.
+template<typename T, typename U>
+typename std::add_lvalue_reference<T>::type exact_runtime_cast(U& u) {
+    typedef typename std::remove_reference<T>::type impl_type;
+    impl_type* value = detail::exact_runtime_cast_impl<impl_type>(std::addressof(u));
+    if(!value)
+        BOOST_THROW_EXCEPTION(bad_runtime_cast());
+    return *value;
+}
+
+/// \brief Converts references to the class that is the exact dynamic type of the instance.
+/// \tparam T The desired target type. Must be a reference to complete class type.
+/// \tparam U A complete class type of the source instance, u.
+/// \return If the most derived class of u that implements the runtime_cast is the target class, returns a T const
+/// that references that instance. Otherwise throws boost::typeindex::bad_runtime_cast.
+template<typename T, typename U>
+typename std::add_lvalue_reference<const T>::type exact_runtime_cast(U const& u) {
+    typedef typename std::remove_reference<T>::type impl_type;
+    impl_type* value = detail::exact_runtime_cast_impl<impl_type>(std::addressof(u));
+    if(!value)
+        BOOST_THROW_EXCEPTION(bad_runtime_cast());
+    return *value;
+}
+
 }} // namespace boost::typeindex
 
 #endif // BOOST_TYPE_INDEX_RUNTIME_CAST_REFERENCE_CAST_HPP
@@ -13,6 +13,8 @@
 /// \brief Contains the macros BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST and
 /// BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS
 #include <boost/type_index.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_cast_cache.hpp>
+#include <boost/type_index/runtime_cast/detail/runtime_class_table.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -26,17 +28,66 @@ inline type_index runtime_class_construct_type_id(T const*) {
 }
 
 template <class Self>
-constexpr const void* find_instance(boost::typeindex::type_index const&, const Self*) noexcept {
+constexpr const void* find_instance(boost::typeindex::type_index const&, const Self*, bool&) noexcept {
     return nullptr;
 }
 
+// Searches the bases of Self for the instance of the requested type. `static_offset` is set to false
+// if the found instance is reachable only through a virtual base.
 template <class Base, class... OtherBases, class Self>
-const void* find_instance(boost::typeindex::type_index const& idx, const Self* self) noexcept {
-    if (const void* ptr = self->Base::boost_type_index_find_instance_(idx)) {
+const void* find_instance(boost::typeindex::type_index const& idx, const Self* self, bool& static_offset) noexcept {
+    if (const void* ptr = self->Base::boost_type_index_find_instance_walk_(idx, static_offset)) {
+        static_offset = static_offset && is_static_base_of<Base, Self>::value;
         return ptr;
     }
 
-    return boost::typeindex::detail::find_instance<OtherBases...>(idx, self);
+    return boost::typeindex::detail::find_instance<OtherBases...>(idx, self, static_offset);
+}
+
+// Unique per class address, used as a key for the runtime_cast_cache
+template <class Self>
+struct runtime_class_key {
+    static const char value;
+};
+
+template <class Self>
+const char runtime_class_key<Self>::value = 0;
+
+template <class Self>
+const void* runtime_class_key_of(const Self*) noexcept {
+    return &runtime_class_key<Self>::value;
+}
+
+// The search depends only on Self and the requested type, so the result is cached for the pair.
+// Offsets of the instances that are reachable through virtual bases differ in the classes derived
+// from Self, so for them only the fact that the instance exists is cached.
+template <class Self>
+const void* find_instance_cached(boost::typeindex::type_index const& idx, const Self* self) noexcept {
+    runtime_cast_cache& cache = runtime_cast_cache::instance();
+    const void* const class_key = &runtime_class_key<Self>::value;
+    const void* const type_key = &idx.type_info();
+
+    const char* const self_bytes = reinterpret_cast<const char*>(self);
+    if (const runtime_cast_result* cached = cache.find(class_key, type_key)) {
+        switch (cached->kind) {
+        case runtime_cast_result::not_found: return nullptr;
+        case runtime_cast_result::static_offset: return self_bytes + cached->offset;
+        case runtime_cast_result::dynamic_offset: break;
+        }
+
+        bool static_offset = true;
+        return self->boost_type_index_find_instance_walk_(idx, static_offset);
+    }
+
+    bool static_offset = true;
+    const void* const ptr = self->boost_type_index_find_instance_walk_(idx, static_offset);
+    runtime_cast_result result = {runtime_cast_result::not_found, 0};
+    if (ptr) {
+        result.kind = (static_offset ? runtime_cast_result::static_offset : runtime_cast_result::dynamic_offset);
+        result.offset = static_cast<const char*>(ptr) - self_bytes;
+    }
+    cache.insert(class_key, type_key, result);
+    return ptr;
 }
 
 }}} // namespace boost::typeindex::detail
@@ -50,6 +101,12 @@ const void* find_instance(boost::typeindex::type_index const& idx, const Self* s
 /// boost::typeindex::runtime_cast to accurately convert between dynamic types of instances of
 /// the current class.
 ///
+/// Results of the search through the bases are cached in a process wide lock-free hash table for each
+/// pair of the current class and the requested type, so repeated casts usually cost a single lookup.
+/// With BOOST_TYPE_INDEX_RUNTIME_CAST_BASE_TABLE defined the macro also emits a compile time table of all the bases.
+/// Casts to final classes and boost::typeindex::exact_runtime_cast only compare the requested type with the
+/// current class and do not search through the bases.
+///
 /// BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS also adds support for boost::typeindex::type_id_runtime
 /// by including BOOST_TYPE_INDEX_REGISTER_CLASS. It is typical that these features are used together,
 /// but in the event that BOOST_TYPE_INDEX_REGISTER_CLASS is undesirable in the current class,
@@ -125,12 +182,40 @@ const void* find_instance(boost::typeindex::type_index const& idx, const Self* s
 ///
 /// \param base_class_seq A Boost.Preprocessor sequence of the current class' direct bases, or
 /// BOOST_TYPE_INDEX_NO_BASE_CLASS if this class has no direct base classes.
+#if defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_BASE_TABLE)
+#define BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(...)                                                              \
+    typedef boost::typeindex::detail::runtime_class_bases<__VA_ARGS__> boost_type_index_direct_bases_;            \
+    virtual boost::typeindex::detail::runtime_class_table const* boost_type_index_table_(                        \
+            void const*& self) const noexcept {                                                                   \
+        self = this;                                                                                              \
+        return boost::typeindex::detail::runtime_class_table_of(this);                                            \
+    }                                                                                                             \
+    BOOST_TYPE_INDEX_DETAIL_IMPLEMENT_RUNTIME_CAST_SEARCH(__VA_ARGS__)
+#else
 #define BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(...)                                                              \
+    BOOST_TYPE_INDEX_DETAIL_IMPLEMENT_RUNTIME_CAST_SEARCH(__VA_ARGS__)
+#endif
+
+/// @cond
+#define BOOST_TYPE_INDEX_DETAIL_IMPLEMENT_RUNTIME_CAST_SEARCH(...)                                                \
     virtual void const* boost_type_index_find_instance_(boost::typeindex::type_index const& idx) const noexcept { \
+        return boost::typeindex::detail::find_instance_cached(idx, this);                                         \
+    }                                                                                                             \
+    virtual void const* boost_type_index_runtime_class_key_(void const*& self) const noexcept {                   \
+        self = this;                                                                                              \
+        return boost::typeindex::detail::runtime_class_key_of(this);                                              \
+    }                                                                                                             \
+    virtual void const* boost_type_index_find_exact_instance_(                                                    \
+            boost::typeindex::type_index const& idx) const noexcept {                                             \
+        return idx == boost::typeindex::detail::runtime_class_construct_type_id(this) ? this : nullptr;           \
+    }                                                                                                             \
+    void const* boost_type_index_find_instance_walk_(boost::typeindex::type_index const& idx,                     \
+                                                     bool& static_offset) const noexcept {                        \
         if(idx == boost::typeindex::detail::runtime_class_construct_type_id(this))                                \
             return this;                                                                                          \
-        return boost::typeindex::detail::find_instance<__VA_ARGS__>(idx, this);                                   \
+        return boost::typeindex::detail::find_instance<__VA_ARGS__>(idx, this, static_offset);                    \
     }
+/// @endcond
 
 /// \def BOOST_TYPE_INDEX_NO_BASE_CLASS
 /// \brief Instructs BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS and BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST
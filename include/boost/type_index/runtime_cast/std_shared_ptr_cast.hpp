@@ -15,6 +15,19 @@
 
 #include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
 #include <memory>
+#include <utility>
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+// There is no feature test macro for the aliasing move constructor of std::shared_ptr, the arrays support for
+// std::make_shared comes with the same C++20 changes and is provided only by the libraries that have it.
+#if defined(__cpp_lib_shared_ptr_arrays) && (__cpp_lib_shared_ptr_arrays >= 201707L)
+#  define BOOST_TYPE_INDEX_DETAIL_HAS_SHARED_PTR_ALIASING_MOVE
+#endif
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -40,6 +53,31 @@ std::shared_ptr<T> runtime_pointer_cast(std::shared_ptr<U> const& u) {
     return std::shared_ptr<T>();
 }
 
+/// \brief Creates a new instance of std::shared_ptr that takes the ownership from u and whose stored pointer
+/// is obtained from u's stored pointer using a runtime_cast.
+///
+/// On success u becomes empty and, with a C++20 Standard Library, the reference count is not modified. If the runtime_cast
+/// performed by runtime_pointer_cast returns a null pointer, u is left intact and an empty shared_ptr is returned.
+/// \tparam T The desired target type to return a pointer of.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a std::shared_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns std::shared_ptr<T>();
+template<typename T, typename U>
+std::shared_ptr<T> runtime_pointer_cast(std::shared_ptr<U>&& u) noexcept {
+    T* value = detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>());
+    if(!value)
+        return std::shared_ptr<T>();
+#if defined(BOOST_TYPE_INDEX_DETAIL_HAS_SHARED_PTR_ALIASING_MOVE)
+    return std::shared_ptr<T>(std::move(u), value);
+#else
+    // No aliasing move constructor in the Standard Library
+    std::shared_ptr<T> result(u, value);
+    u.reset();
+    return result;
+#endif
+}
+
 }} // namespace boost::typeindex
 
 #endif // BOOST_TYPE_INDEX_RUNTIME_CAST_STD_SHARED_PTR_CAST_HPP
@@ -0,0 +1,48 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_RUNTIME_CAST_STD_UNIQUE_PTR_CAST_HPP
+#define BOOST_TYPE_INDEX_RUNTIME_CAST_STD_UNIQUE_PTR_CAST_HPP
+
+/// \file std_unique_ptr_cast.hpp
+/// \brief Contains the overload of boost::typeindex::runtime_pointer_cast for
+/// std::unique_ptr types.
+
+#include <boost/type_index/runtime_cast/detail/runtime_cast_impl.hpp>
+#include <memory>
+#include <type_traits>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+/// \brief Creates a new instance of std::unique_ptr that takes the ownership from u and whose stored pointer
+/// is obtained from u's stored pointer using a runtime_cast.
+///
+/// If the runtime_cast performed by runtime_pointer_cast returns a null pointer, u is left intact and an empty
+/// unique_ptr is returned.
+/// \tparam T The desired target type to return a pointer of. Must have a virtual destructor.
+/// \tparam U A complete class type of the source instance pointed to from u.
+/// \return If there exists a valid conversion from U* to T*, returns a std::unique_ptr<T>
+/// that points to an address suitably offset from u.
+/// If no such conversion exists, returns std::unique_ptr<T>();
+template<typename T, typename U>
+std::unique_ptr<T> runtime_pointer_cast(std::unique_ptr<U>&& u) noexcept {
+    static_assert(std::has_virtual_destructor<T>::value, "The target type T must have a virtual destructor.");
+
+    T* value = detail::runtime_cast_impl<T>(u.get(), std::is_base_of<T, U>());
+    if(value)
+        u.release();
+    return std::unique_ptr<T>(value);
+}
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_RUNTIME_CAST_STD_UNIQUE_PTR_CAST_HPP
@@ -27,11 +27,31 @@
 #endif
 
 #include <typeinfo>
-#include <cstring>                                  // std::strcmp, std::strlen, std::strstr
+#include <cstring>                                  // std::strcmp, std::strlen
+#include <cstdint>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <new>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
 #include <boost/throw_exception.hpp>
 #include <boost/core/demangle.hpp>
+#include <boost/type_index/detail/stl_type_info_cache.hpp>
+#include <boost/type_index/detail/strip_cvr_saver.hpp>
+
+/// @cond
+#if defined(__GLIBCXX__) && !defined(BOOST_TYPE_INDEX_STL_NO_BUILTIN_DEMANGLER)
+#include <boost/type_index/demangle.hpp>
+#  if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES)
+// Output of the built-in demangler matches only the libstdc++ __cxa_demangle
+#    define BOOST_TYPE_INDEX_DETAIL_STL_BUILTIN_DEMANGLER
+#  endif
+#endif
+/// @endcond
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
@@ -39,6 +59,10 @@
 
 namespace boost { namespace typeindex {
 
+/// @cond
+namespace detail { struct stl_type_info_names; struct stl_type_info_compact_names; }
+/// @endcond
+
 /// \class stl_type_index
 /// This class is a wrapper around std::type_info, that workarounds issues and provides
 /// much more rich interface. \b For \b description \b of \b functions \b see type_index_facade.
@@ -78,8 +102,20 @@ public:
     inline const char*  raw_name() const noexcept;
     inline const char*  name() const noexcept;
     inline std::string  pretty_name() const;
+    inline std::string  compact_name() const;
+    inline std::string  short_name() const;
+    inline std::string  normalized_name() const;
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    inline std::string_view raw_name_view() const noexcept;
+    inline std::string_view pretty_name_view() const;
+    inline std::string_view compact_name_view() const;
+    inline std::string_view short_name_view() const;
+    inline std::string_view normalized_name_view() const;
+#endif
 
     inline std::size_t  hash_code() const noexcept;
+    inline std::uint64_t fingerprint() const;
+    inline std::uint64_t normalized_fingerprint() const;
     inline bool         equal(const stl_type_index& rhs) const noexcept;
     inline bool         before(const stl_type_index& rhs) const noexcept;
 
@@ -91,6 +127,17 @@ public:
 
     template <class T>
     inline static stl_type_index type_id_runtime(const T& value) noexcept;
+
+#ifndef BOOST_NO_IOSTREAM
+    /// Outputs the pretty_name() from the process wide cache of the names, without allocating memory
+    /// after the first demangling of the type.
+    template <class CharT, class TriatT>
+    friend std::basic_ostream<CharT, TriatT>& operator<<(std::basic_ostream<CharT, TriatT>& ostr, const stl_type_index& ind);
+#endif
+
+private:
+    inline const detail::stl_type_info_names* cached_names() const;
+    inline const detail::stl_type_info_compact_names* cached_compact_names() const;
 };
 
 inline const stl_type_index::type_info_t& stl_type_index::type_info() const noexcept {
@@ -110,61 +157,88 @@ inline const char* stl_type_index::name() const noexcept {
     return data_->name();
 }
 
-inline std::string stl_type_index::pretty_name() const {
-    static const char cvr_saver_name[] = "boost::typeindex::detail::cvr_saver<";
-    static BOOST_CONSTEXPR_OR_CONST std::string::size_type cvr_saver_name_len = sizeof(cvr_saver_name) - 1;
-
-    // In case of MSVC demangle() is a no-op, and name() already returns demangled name.
-    // In case of GCC and Clang (on non-Windows systems) name() returns mangled name and demangle() undecorates it.
-    const boost::core::scoped_demangled_name demangled_name(data_->name());
-
-    const char* begin = demangled_name.get();
-    if (!begin) {
-        boost::throw_exception(std::runtime_error("Type name demangling failed"));
-    }
-
-    const std::string::size_type len = std::strlen(begin);
-    const char* end = begin + len;
-
-    if (len > cvr_saver_name_len) {
-        const char* b = std::strstr(begin, cvr_saver_name);
-        if (b) {
-            b += cvr_saver_name_len;
-
-            // Trim leading spaces
-            while (*b == ' ') {         // the string is zero terminated, we won't exceed the buffer size
-                ++ b;
-            }
-
-            // Skip the closing angle bracket
-            const char* e = end - 1;
-            while (e > b && *e != '>') {
-                -- e;
-            }
-
-            // Trim trailing spaces
-            while (e > b && *(e - 1) == ' ') {
-                -- e;
-            }
+/// @cond
+namespace detail {
 
-            if (b < e) {
-                // Parsing seems to have succeeded, the type name is not empty
-                begin = b;
-                end = e;
+    struct stl_type_info_hash {
+        template <class TypeInfo>
+        std::size_t operator()(const TypeInfo& ti) const noexcept {
+            return ti.hash_code();
+        }
+    };
+
+    template <class TypeInfo>
+    inline std::string stl_type_info_pretty_name(const TypeInfo& ti) {
+#if defined(BOOST_TYPE_INDEX_DETAIL_STL_BUILTIN_DEMANGLER)
+        // Output of the built-in demangler matches the libstdc++ __cxa_demangle, so the names and
+        // fingerprints do not depend on which of them was used. It does not allocate memory for the
+        // short names and fails only on constructs that it does not support.
+        char buffer[256];
+        demangle_result result = boost::typeindex::demangle_type_name(ti.name(), buffer, sizeof(buffer));
+        if (result.status == demangle_status::success) {
+            return std::string(buffer, result.size);
+        }
+        if (result.status == demangle_status::buffer_too_small) {
+            std::string name(result.size, '\0');
+            result = boost::typeindex::demangle_type_name(ti.name(), &name[0], name.size());
+            if (result.status == demangle_status::success) {
+                name.resize(result.size);
+                return name;
             }
         }
-    }
+#endif
 
-    return std::string(begin, end);
-}
+        // In case of MSVC demangle() is a no-op, and name() already returns demangled name.
+        // In case of GCC and Clang (on non-Windows systems) name() returns mangled name and demangle() undecorates it.
+        const boost::core::scoped_demangled_name demangled_name(ti.name());
 
+        const char* begin = demangled_name.get();
+        if (!begin) {
+            boost::throw_exception(std::runtime_error("Type name demangling failed"));
+        }
 
-inline std::size_t stl_type_index::hash_code() const noexcept {
-    return data_->hash_code();
-}
+        const char* end = begin + std::strlen(begin);
+        detail::strip_cvr_saver(begin, end);
+        return std::string(begin, end);
+    }
 
+    struct stl_type_info_names {
+        std::string     pretty_name;    // never modified after construction, so its data() is stable
+        std::uint64_t   fingerprint;    // hash of the pretty_name
+    };
+
+    struct stl_type_info_names_factory {
+        template <class TypeInfo>
+        stl_type_info_names operator()(const TypeInfo& ti) const {
+            std::string name = detail::stl_type_info_pretty_name(ti);
+            const std::uint64_t fingerprint = boost::typeindex::detail::name_hash(name.data(), name.size());
+            return stl_type_info_names{std::move(name), fingerprint};
+        }
+    };
+
+    struct stl_type_info_compact_names {
+        std::string     compact_name;   // never modified after construction, so its data() is stable
+        std::string     short_name;     // never modified after construction, so its data() is stable
+        std::string     normalized_name;        // never modified after construction, so its data() is stable
+        std::uint64_t   normalized_fingerprint; // hash of the normalized_name
+    };
+
+    struct stl_type_info_compact_names_factory {
+        template <class TypeInfo>
+        stl_type_info_compact_names operator()(const TypeInfo& ti) const {
+            std::string compact_name = boost::typeindex::detail::compact_type_name(stl_type_index(ti).pretty_name(), false);
+            std::string short_name = compact_name;
+            short_name.resize(boost::typeindex::detail::strip_namespaces(&short_name[0], short_name.size()));
+            std::string normalized_name = boost::typeindex::detail::normalize_type_name(compact_name);
+            const std::uint64_t normalized_fingerprint
+                = boost::typeindex::detail::name_hash(normalized_name.data(), normalized_name.size());
+            return stl_type_info_compact_names{
+                std::move(compact_name), std::move(short_name), std::move(normalized_name), normalized_fingerprint
+            };
+        }
+    };
 
-/// @cond
+} // namespace detail
 
 // for this compiler at least, cross-shared-library type_info
 // comparisons don't work, so we are using typeid(x).name() instead.
@@ -178,6 +252,119 @@ inline std::size_t stl_type_index::hash_code() const noexcept {
 
 /// @endcond
 
+inline std::size_t stl_type_index::hash_code() const noexcept {
+#ifdef BOOST_TYPE_INDEX_CLASSINFO_COMPARE_BY_NAMES
+    // type_info::hash_code() may differ for the same types from different modules
+    return static_cast<std::size_t>(boost::typeindex::detail::name_hash(raw_name()));
+#elif defined(BOOST_TYPE_INDEX_STL_CACHE_HASH)
+    // Some Standard Libraries hash the whole type name on each call
+    const detail::stl_type_info_cache_entry<type_info_t, std::size_t>* const entry
+        = detail::stl_type_info_cache<type_info_t, std::size_t>::instance().find(*data_, detail::stl_type_info_hash());
+    return entry ? entry->value : data_->hash_code();
+#else
+    return data_->hash_code();
+#endif
+}
+
+inline const detail::stl_type_info_names* stl_type_index::cached_names() const {
+    // Demangling is slow and allocates memory, doing it once per type
+    const detail::stl_type_info_cache_entry<type_info_t, detail::stl_type_info_names>* const entry
+        = detail::stl_type_info_cache<type_info_t, detail::stl_type_info_names>::instance().find(
+            *data_, detail::stl_type_info_names_factory()
+        );
+    return entry ? &entry->value : nullptr;
+}
+
+inline std::string stl_type_index::pretty_name() const {
+    const detail::stl_type_info_names* const names = cached_names();
+    return names ? names->pretty_name : detail::stl_type_info_pretty_name(*data_);
+}
+
+inline const detail::stl_type_info_compact_names* stl_type_index::cached_compact_names() const {
+    // Separate cache, so that the users of pretty_name() do not pay for the compact names
+    const detail::stl_type_info_cache_entry<type_info_t, detail::stl_type_info_compact_names>* const entry
+        = detail::stl_type_info_cache<type_info_t, detail::stl_type_info_compact_names>::instance().find(
+            *data_, detail::stl_type_info_compact_names_factory()
+        );
+    return entry ? &entry->value : nullptr;
+}
+
+inline std::string stl_type_index::compact_name() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    return names ? names->compact_name : detail::stl_type_info_compact_names_factory()(*data_).compact_name;
+}
+
+inline std::string stl_type_index::short_name() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    return names ? names->short_name : detail::stl_type_info_compact_names_factory()(*data_).short_name;
+}
+
+inline std::string stl_type_index::normalized_name() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    return names ? names->normalized_name : detail::stl_type_info_compact_names_factory()(*data_).normalized_name;
+}
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+inline std::string_view stl_type_index::raw_name_view() const noexcept {
+    return std::string_view(raw_name());
+}
+
+inline std::string_view stl_type_index::pretty_name_view() const {
+    const detail::stl_type_info_names* const names = cached_names();
+    if (!names) {
+        // There's no storage for the name that outlives this call
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->pretty_name);
+}
+
+inline std::string_view stl_type_index::compact_name_view() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    if (!names) {
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->compact_name);
+}
+
+inline std::string_view stl_type_index::short_name_view() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    if (!names) {
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->short_name);
+}
+
+inline std::string_view stl_type_index::normalized_name_view() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    if (!names) {
+        boost::throw_exception(std::bad_alloc());
+    }
+    return std::string_view(names->normalized_name);
+}
+#endif
+
+#ifndef BOOST_NO_IOSTREAM
+template <class CharT, class TriatT>
+inline std::basic_ostream<CharT, TriatT>& operator<<(std::basic_ostream<CharT, TriatT>& ostr, const stl_type_index& ind) {
+    const detail::stl_type_info_names* const names = ind.cached_names();
+    if (!names) {
+        return ostr << ind.pretty_name();
+    }
+    return boost::typeindex::detail::ostream_insert(ostr, names->pretty_name.data(), names->pretty_name.size());
+}
+#endif
+
+inline std::uint64_t stl_type_index::fingerprint() const {
+    const detail::stl_type_info_names* const names = cached_names();
+    return names ? names->fingerprint : detail::stl_type_info_names_factory()(*data_).fingerprint;
+}
+
+inline std::uint64_t stl_type_index::normalized_fingerprint() const {
+    const detail::stl_type_info_compact_names* const names = cached_compact_names();
+    return names ? names->normalized_fingerprint : detail::stl_type_info_compact_names_factory()(*data_).normalized_fingerprint;
+}
+
+
 inline bool stl_type_index::equal(const stl_type_index& rhs) const noexcept {
 #ifdef BOOST_TYPE_INDEX_CLASSINFO_COMPARE_BY_NAMES
     return raw_name() == rhs.raw_name() || !std::strcmp(raw_name(), rhs.raw_name());
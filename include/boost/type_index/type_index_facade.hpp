@@ -11,17 +11,32 @@
 
 #include <boost/config.hpp>
 #include <boost/container_hash/hash_fwd.hpp>
+#include <boost/type_index/detail/normalized_name.hpp>
+#include <boost/type_index/detail/name_hash.hpp>
 #include <string>
 #include <cstring>
+#include <cstdint>
 #include <type_traits>
 #include <iosfwd>               // for std::basic_ostream
 
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
+
 #ifdef BOOST_HAS_PRAGMA_ONCE
 # pragma once
 #endif
 
 namespace boost { namespace typeindex {
 
+/// @cond
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+namespace detail {
+    template <class TypeIndex> struct has_pretty_name_view;
+}
+#endif
+/// @endcond
+
 /// \class type_index_facade
 ///
 /// This class takes care about the comparison operators, hash functions and 
@@ -75,6 +90,58 @@ public:
         return derived().name();
     }
 
+    /// \b Override: This function \b may be redefined in Derived class. Overrides may throw.
+    /// \return pretty_name() without the Standard Library inline namespaces and default template arguments
+    /// of the Standard Library templates, with the well known aliases collapsed. For example
+    /// `std::map<std::string, std::vector<int> >` instead of the `std::map<std::__cxx11::basic_string<char,
+    /// std::char_traits<char>, std::allocator<char> >, std::vector<int, std::allocator<int> >, ...>`.
+    /// By default computes it from the Derived::pretty_name() on each call.
+    inline std::string compact_name() const {
+        return boost::typeindex::detail::compact_type_name(derived().pretty_name(), false);
+    }
+
+    /// \b Override: This function \b may be redefined in Derived class. Overrides may throw.
+    /// \return compact_name() without the namespace qualifiers, for example `map<string, vector<int> >`.
+    /// Different types may have the same short_name(). By default computes it from the Derived::pretty_name() on each call.
+    inline std::string short_name() const {
+        return boost::typeindex::detail::compact_type_name(derived().pretty_name(), true);
+    }
+
+    /// \b Override: This function \b may be redefined in Derived class. Overrides may throw.
+    /// \return compact_name() in a spelling that does not depend on the way the name was obtained:
+    /// builtin types are spelled as `unsigned long`, `const` and `volatile` follow the type, anonymous namespaces
+    /// are `(anonymous namespace)`, integral template arguments are plain decimal numbers. So ctti_type_index and
+    /// stl_type_index produce the same normalized_name() for most of the types. Known exceptions are
+    /// enumerators used as template arguments (`ET<E::a>` for ctti_type_index and `ET<(E)0>` for stl_type_index)
+    /// and defaulted arguments of the user templates, that ctti_type_index may omit (`MyVec<int>` vs
+    /// `MyVec<int, std::allocator<int> >`).
+    /// By default computes it from the Derived::compact_name() on each call. ctti_type_index and stl_type_index
+    /// compute it once per type at runtime and keep it in a process wide cache, unless
+    /// BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES is defined for ctti_type_index to compute it at compile time.
+    inline std::string normalized_name() const {
+        return boost::typeindex::detail::normalize_type_name(derived().compact_name());
+    }
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW) || defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
+    /// \b Override: This function \b may be redefined in Derived class. Overrides \b must not throw.
+    /// \return View of the raw_name(), that does not require dynamic memory allocation.
+    /// Available only if std::string_view is provided by the Standard Library.
+    inline std::string_view raw_name_view() const noexcept {
+        return std::string_view(derived().raw_name());
+    }
+
+    /// \b Override: This function \b must be redefined in Derived class if pretty_name() is redefined. Overrides may throw.
+    /// \return View of the pretty_name(), that does not require dynamic memory allocation. Viewed characters
+    /// must be valid till the end of the program. By default returns view of Derived::name(), does not compile
+    /// if pretty_name() is redefined.
+    /// Available only if std::string_view is provided by the Standard Library.
+    inline std::string_view pretty_name_view() const {
+        static_assert(boost::typeindex::detail::has_pretty_name_view<Derived>::value,
+            "Derived class redefines pretty_name(), so it must redefine pretty_name_view()");
+        return std::string_view(derived().name());
+    }
+#endif
+
     /// \b Override: This function \b may be redefined in Derived class. Overrides \b must not throw.
     /// \return True if two types are equal. By default compares types by raw_name().
     inline bool equal(const Derived& rhs) const noexcept {
@@ -92,12 +159,29 @@ public:
     }
 
     /// \b Override: This function \b may be redefined in Derived class. Overrides \b must not throw.
-    /// \return Hash code of a type. By default hashes types by raw_name().
-    /// \note Derived class header \b must include <boost/container_hash/hash.hpp>, \b unless this function is redefined in
-    /// Derived class to not use boost::hash_range().
+    /// \return Hash code of a type. By default hashes types by raw_name(), processing 8 bytes of the name per step.
+    /// The same name has the same hash code in every process.
     inline std::size_t hash_code() const noexcept {
-        const char* const name_raw = derived().raw_name();
-        return boost::hash_range(name_raw, name_raw + std::strlen(name_raw));
+        return static_cast<std::size_t>(boost::typeindex::detail::name_hash(derived().raw_name()));
+    }
+
+    /// \b Override: This function \b may be redefined in Derived class. Overrides may throw.
+    /// \return 64-bit hash of the pretty_name(). Unlike hash_code() it does not depend on the process:
+    /// the same type has the same fingerprint in all the programs built by the same toolchain with the
+    /// same type_index class. By default hashes Derived::pretty_name().
+    inline std::uint64_t fingerprint() const {
+        const std::string name = derived().pretty_name();
+        return boost::typeindex::detail::name_hash(name.data(), name.size());
+    }
+
+    /// \b Override: This function \b may be redefined in Derived class. Overrides may throw.
+    /// \return 64-bit hash of the normalized_name(). Unlike fingerprint(), it is usually the same for
+    /// ctti_type_index and stl_type_index of the same type, see normalized_name() for the exceptions.
+    /// By default hashes Derived::normalized_name(). ctti_type_index and stl_type_index take it from the same
+    /// storage as normalized_name().
+    inline std::uint64_t normalized_fingerprint() const {
+        const std::string name = derived().normalized_name();
+        return boost::typeindex::detail::name_hash(name.data(), name.size());
     }
 
 #if defined(BOOST_TYPE_INDEX_DOXYGEN_INVOKED)
@@ -144,6 +228,44 @@ protected:
 };
 
 /// @cond
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+namespace detail {
+
+    // True if TypeIndex::pretty_name_view() views the TypeIndex::pretty_name(): either the view is redefined
+    // in TypeIndex, or both functions are the defaults of the type_index_facade.
+    template <class TypeIndex>
+    struct has_pretty_name_view: std::integral_constant<bool,
+        !std::is_same<
+            decltype(&TypeIndex::pretty_name_view),
+            std::string_view (type_index_facade<TypeIndex, typename TypeIndex::type_info_t>::*)() const
+        >::value
+        || std::is_same<
+            decltype(&TypeIndex::pretty_name),
+            std::string (type_index_facade<TypeIndex, typename TypeIndex::type_info_t>::*)() const
+        >::value
+    > {};
+
+    template <class TypeIndex>
+    inline std::string_view pretty_name_or_view(const TypeIndex& value, std::true_type /*has_pretty_name_view*/) {
+        return value.pretty_name_view();
+    }
+
+    template <class TypeIndex>
+    inline std::string pretty_name_or_view(const TypeIndex& value, std::false_type /*has_pretty_name_view*/) {
+        return value.pretty_name();
+    }
+
+    // Returns pretty_name_view() if it views the pretty_name(), the pretty_name() otherwise
+    template <class TypeIndex>
+    inline auto pretty_name_or_view(const TypeIndex& value)
+        -> decltype(detail::pretty_name_or_view(value, has_pretty_name_view<TypeIndex>()))
+    {
+        return detail::pretty_name_or_view(value, has_pretty_name_view<TypeIndex>());
+    }
+
+} // namespace detail
+#endif
+
 template <class Derived, class TypeInfo>
 BOOST_CXX14_CONSTEXPR inline bool operator == (const type_index_facade<Derived, TypeInfo>& lhs, const type_index_facade<Derived, TypeInfo>& rhs) noexcept {
     return static_cast<Derived const&>(lhs).equal(static_cast<Derived const&>(rhs));
@@ -256,7 +378,44 @@ bool operator ==, !=, <, ... (const TypeInfo& lhs, const type_index_facade& rhs)
 #endif
 
 #ifndef BOOST_NO_IOSTREAM
+/// @cond
+namespace detail {
+
+    // Writes the name honoring the width(), fill() and adjustfield of the stream, like
+    // `ostr << std::string(name, size)` does, but without constructing a temporary string.
+    template <class CharT, class TriatT>
+    inline std::basic_ostream<CharT, TriatT>& ostream_insert(std::basic_ostream<CharT, TriatT>& ostr, const char* name, std::size_t size) {
+        typedef std::basic_ostream<CharT, TriatT> ostream_t;
+
+        const typename ostream_t::sentry guard(ostr);
+        if (!guard) {
+            return ostr;
+        }
+
+        const std::streamsize length = static_cast<std::streamsize>(size);
+        const std::streamsize padding = ostr.width() > length ? ostr.width() - length : 0;
+        const bool left = ((ostr.flags() & ostream_t::adjustfield) == ostream_t::left);
+        bool ok = true;
+        for (std::streamsize i = 0; ok && !left && i < padding; ++i) {
+            ok = !TriatT::eq_int_type(ostr.rdbuf()->sputc(ostr.fill()), TriatT::eof());
+        }
+        ok = ok && ostr.rdbuf()->sputn(name, length) == length;
+        for (std::streamsize i = 0; ok && left && i < padding; ++i) {
+            ok = !TriatT::eq_int_type(ostr.rdbuf()->sputc(ostr.fill()), TriatT::eof());
+        }
+
+        ostr.width(0);
+        if (!ok) {
+            ostr.setstate(ostream_t::badbit);
+        }
+        return ostr;
+    }
+
+} // namespace detail
+/// @endcond
+
 /// Ostream operator that will output demangled name.
+/// ctti_type_index and stl_type_index have their own overloads that do not allocate memory.
 template <class CharT, class TriatT, class Derived, class TypeInfo>
 inline std::basic_ostream<CharT, TriatT>& operator<<(
     std::basic_ostream<CharT, TriatT>& ostr, 
@@ -0,0 +1,176 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_TYPE_INDEX_HASH_HPP
+#define BOOST_TYPE_INDEX_TYPE_INDEX_HASH_HPP
+
+/// \file type_index_hash.hpp
+/// \brief Contains transparent hash, equality and ordering functors for containers of type_index.
+///
+/// The functors allow heterogeneous lookup in unordered containers: a type could be found by
+/// the type_index, by the low level type_info or by the pretty_name() without constructing a
+/// temporary type_index or std::string.
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/detail/name_hash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+/// \class basic_type_index_hash
+/// Transparent hash functor for TypeIndex, TypeIndex::type_info_t and type names.
+///
+/// Hashes are the TypeIndex::fingerprint() values, so the hash of a type and
+/// the hash of its pretty_name() are equal. The values are well mixed,
+/// containers do not need to apply any additional mixing to them.
+///
+/// \tparam TypeIndex ctti_type_index, stl_type_index or other class derived from type_index_facade.
+template <class TypeIndex>
+struct basic_type_index_hash {
+    typedef void            is_transparent;
+    typedef std::true_type  is_avalanching;
+
+    std::size_t operator()(const TypeIndex& value) const {
+        return static_cast<std::size_t>(value.fingerprint());
+    }
+
+    std::size_t operator()(const typename TypeIndex::type_info_t& value) const {
+        return static_cast<std::size_t>(TypeIndex(value).fingerprint());
+    }
+
+    /// \param name Type name in the TypeIndex::pretty_name() format.
+    std::size_t operator()(const char* name) const noexcept {
+        return static_cast<std::size_t>(boost::typeindex::detail::name_hash(name));
+    }
+
+    /// \param name Type name in the TypeIndex::pretty_name() format.
+    std::size_t operator()(const std::string& name) const noexcept {
+        return static_cast<std::size_t>(boost::typeindex::detail::name_hash(name.data(), name.size()));
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    /// \param name Type name in the TypeIndex::pretty_name() format.
+    std::size_t operator()(std::string_view name) const noexcept {
+        return static_cast<std::size_t>(boost::typeindex::detail::name_hash(name.data(), name.size()));
+    }
+#endif
+};
+
+/// \class basic_type_index_equal
+/// Transparent equality functor for TypeIndex, TypeIndex::type_info_t and type names.
+/// Should be used together with basic_type_index_hash.
+///
+/// \tparam TypeIndex ctti_type_index, stl_type_index or other class derived from type_index_facade.
+template <class TypeIndex>
+struct basic_type_index_equal {
+    typedef void is_transparent;
+
+    bool operator()(const TypeIndex& lhs, const TypeIndex& rhs) const noexcept {
+        return lhs == rhs;
+    }
+
+    bool operator()(const TypeIndex& lhs, const typename TypeIndex::type_info_t& rhs) const noexcept {
+        return lhs == TypeIndex(rhs);
+    }
+
+    bool operator()(const typename TypeIndex::type_info_t& lhs, const TypeIndex& rhs) const noexcept {
+        return TypeIndex(lhs) == rhs;
+    }
+
+    bool operator()(const TypeIndex& lhs, const char* rhs) const {
+        return equal_to_name(lhs, rhs, std::strlen(rhs));
+    }
+
+    bool operator()(const char* lhs, const TypeIndex& rhs) const {
+        return equal_to_name(rhs, lhs, std::strlen(lhs));
+    }
+
+    bool operator()(const TypeIndex& lhs, const std::string& rhs) const {
+        return equal_to_name(lhs, rhs.data(), rhs.size());
+    }
+
+    bool operator()(const std::string& lhs, const TypeIndex& rhs) const {
+        return equal_to_name(rhs, lhs.data(), lhs.size());
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    bool operator()(const TypeIndex& lhs, std::string_view rhs) const {
+        return equal_to_name(lhs, rhs.data(), rhs.size());
+    }
+
+    bool operator()(std::string_view lhs, const TypeIndex& rhs) const {
+        return equal_to_name(rhs, lhs.data(), lhs.size());
+    }
+#endif
+
+private:
+    static bool equal_to_name(const TypeIndex& value, const char* name, std::size_t size) {
+        // Fingerprints are cheap to get, comparing them first to avoid getting the pretty_name()
+        return value.fingerprint() == boost::typeindex::detail::name_hash(name, size)
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+            && boost::typeindex::detail::pretty_name_or_view(value) == std::string_view(name, size);
+#else
+            && value.pretty_name().compare(0, std::string::npos, name, size) == 0;
+#endif
+    }
+};
+
+/// \class basic_type_index_fast_less
+/// Transparent strict weak ordering of TypeIndex and TypeIndex::type_info_t by TypeIndex::fingerprint(),
+/// falling back to TypeIndex::before() only for types with equal fingerprints.
+///
+/// The order is not lexicographical, but it is the same in all the programs built by the same toolchain.
+/// Comparing the fingerprints is much cheaper than comparing the long names of template instantiations, so
+/// use it for sorted containers and binary searches when the order of types does not matter. For
+/// example `boost::container::flat_set<TypeIndex, basic_type_index_fast_less<TypeIndex> >`.
+///
+/// \tparam TypeIndex ctti_type_index, stl_type_index or other class derived from type_index_facade.
+template <class TypeIndex>
+struct basic_type_index_fast_less {
+    typedef void is_transparent;
+
+    bool operator()(const TypeIndex& lhs, const TypeIndex& rhs) const {
+        const std::uint64_t left = lhs.fingerprint();
+        const std::uint64_t right = rhs.fingerprint();
+        return left < right || (left == right && lhs.before(rhs));
+    }
+
+    bool operator()(const TypeIndex& lhs, const typename TypeIndex::type_info_t& rhs) const {
+        return (*this)(lhs, TypeIndex(rhs));
+    }
+
+    bool operator()(const typename TypeIndex::type_info_t& lhs, const TypeIndex& rhs) const {
+        return (*this)(TypeIndex(lhs), rhs);
+    }
+};
+
+/// Transparent hash functor for boost::typeindex::type_index. See basic_type_index_hash for more info.
+typedef basic_type_index_hash<type_index> type_index_hash;
+
+/// Transparent equality functor for boost::typeindex::type_index. See basic_type_index_equal for more info.
+typedef basic_type_index_equal<type_index> type_index_equal;
+
+/// Transparent ordering functor for boost::typeindex::type_index. See basic_type_index_fast_less for more info.
+typedef basic_type_index_fast_less<type_index> type_index_fast_less;
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_TYPE_INDEX_HASH_HPP
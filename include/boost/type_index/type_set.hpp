@@ -0,0 +1,245 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_TYPE_INDEX_TYPE_SET_HPP
+#define BOOST_TYPE_INDEX_TYPE_SET_HPP
+
+/// \file type_set.hpp
+/// \brief Contains boost::typeindex::type_set class that maps a fixed set of types to dense indexes.
+
+#include <boost/type_index/ctti_type_index.hpp>
+#include <boost/type_index/detail/name_hash.hpp>
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+namespace boost { namespace typeindex {
+
+/// @cond
+namespace detail {
+
+    // Hash and displace: keys are split into N buckets by the high bits of the fingerprint.
+    // Each bucket has its own seed, chosen at construction so that the keys of all the buckets
+    // land in different slots of a table with exactly N slots.
+    template <std::size_t N>
+    struct type_set_table {
+        std::uint32_t   seeds[N];
+        ctti_type_index keys[N];    // keys[slot] is the type that hashes into the slot
+        std::size_t     indexes[N]; // indexes[slot] is the position of keys[slot] in the type list
+        bool            valid;      // false if the types are not unique
+    };
+
+    BOOST_CXX14_CONSTEXPR inline std::size_t type_set_bucket(std::uint64_t fingerprint, std::size_t size) noexcept {
+        return static_cast<std::size_t>((fingerprint >> 32) % size);
+    }
+
+    BOOST_CXX14_CONSTEXPR inline std::size_t type_set_slot(std::uint64_t fingerprint, std::uint32_t seed, std::size_t size) noexcept {
+        return static_cast<std::size_t>(
+            detail::name_hash_finalize(fingerprint ^ (seed * 0x9e3779b97f4a7c15ULL)) % size
+        );
+    }
+
+    template <std::size_t N>
+    BOOST_CXX14_CONSTEXPR bool type_set_try_seed(type_set_table<N>& table, bool (&used)[N], const ctti_type_index (&types)[N],
+                                                 const std::size_t (&buckets)[N], std::size_t bucket, std::uint32_t seed) noexcept
+    {
+        std::size_t placed = 0;
+        for (; placed < N; ++placed) {
+            if (buckets[placed] != bucket) {
+                continue;
+            }
+
+            const std::size_t slot = detail::type_set_slot(types[placed].fingerprint(), seed, N);
+            if (used[slot]) {
+                break;
+            }
+
+            used[slot] = true;
+            table.keys[slot] = types[placed];
+            table.indexes[slot] = placed;
+        }
+
+        if (placed == N) {
+            table.seeds[bucket] = seed;
+            return true;
+        }
+
+        // Rolling back the slots taken by the keys of this bucket
+        for (std::size_t i = 0; i < placed; ++i) {
+            if (buckets[i] == bucket) {
+                used[detail::type_set_slot(types[i].fingerprint(), seed, N)] = false;
+            }
+        }
+        return false;
+    }
+
+    template <std::size_t N>
+    BOOST_CXX14_CONSTEXPR type_set_table<N> make_type_set_table(const ctti_type_index (&types)[N], std::size_t count) noexcept {
+        type_set_table<N> table{};
+        if (!count) {
+            // Table for the empty set has a single slot, that never matches
+            table.indexes[0] = static_cast<std::size_t>(-1);
+            table.valid = true;
+            return table;
+        }
+
+        std::size_t buckets[N] = {};
+        std::size_t bucket_sizes[N] = {};
+        std::size_t max_bucket_size = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < i; ++j) {
+                if (types[i].fingerprint() == types[j].fingerprint()) {
+                    return table;
+                }
+            }
+
+            buckets[i] = detail::type_set_bucket(types[i].fingerprint(), N);
+            const std::size_t bucket_size = ++bucket_sizes[buckets[i]];
+            max_bucket_size = (bucket_size > max_bucket_size ? bucket_size : max_bucket_size);
+        }
+
+        // Placing the biggest buckets first, while there are many free slots
+        bool used[N] = {};
+        for (std::size_t size = max_bucket_size; size > 0; --size) {
+            for (std::size_t bucket = 0; bucket < N; ++bucket) {
+                if (bucket_sizes[bucket] != size) {
+                    continue;
+                }
+
+                std::uint32_t seed = 0;
+                while (!detail::type_set_try_seed(table, used, types, buckets, bucket, seed)) {
+                    if (++seed == 0) {
+                        return table;
+                    }
+                }
+            }
+        }
+
+        table.valid = true;
+        return table;
+    }
+
+    template <class... Types>
+    BOOST_CXX14_CONSTEXPR type_set_table<(sizeof...(Types) ? sizeof...(Types) : 1)> make_type_set_table() noexcept {
+        const ctti_type_index types[(sizeof...(Types) ? sizeof...(Types) : 1)] = {ctti_type_index::type_id<Types>()...};
+        return detail::make_type_set_table(types, sizeof...(Types));
+    }
+
+    template <class... Types>
+    struct type_set_table_holder {
+        static constexpr std::size_t size = (sizeof...(Types) ? sizeof...(Types) : 1);
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+        static constexpr type_set_table<size> value = detail::make_type_set_table<Types...>();
+
+        constexpr static const type_set_table<size>& get() noexcept {
+            return value;
+        }
+#else
+        // No C++14 constexpr, computing the table once at runtime
+        static const type_set_table<size>& get() noexcept {
+            static const type_set_table<size> value = detail::make_type_set_table<Types...>();
+            BOOST_ASSERT_MSG(value.valid, "type_set<Types...> requires unique types");
+            return value;
+        }
+#endif
+    };
+
+    template <class... Types>
+    constexpr std::size_t type_set_table_holder<Types...>::size;
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+    template <class... Types>
+    constexpr type_set_table<type_set_table_holder<Types...>::size> type_set_table_holder<Types...>::value;
+#endif
+
+} // namespace detail
+/// @endcond
+
+/// \class type_set
+/// Maps each of the Types to its position in the Types list.
+///
+/// The mapping is a minimal perfect hash of the ctti_type_index::fingerprint() values,
+/// computed at compile time on C++14 compatible compilers. A lookup of any type, including the
+/// types that are not in the set, hashes the fingerprint twice and reads two table entries, so
+/// the indexes could be used for the dispatch tables instead of the hash maps:
+///
+/// \code
+/// typedef boost::typeindex::type_set<message_a, message_b, message_c> messages;
+/// handler_t handlers[messages::size()] = {&handle_a, &handle_b, &handle_c};
+///
+/// const std::size_t i = messages::index_of(received_type);
+/// if (i != messages::npos) handlers[i](message);
+/// \endcode
+///
+/// Const, volatile and reference qualifiers are removed from the Types, just like ctti_type_index::type_id<T>() does.
+/// Types must be unique after that.
+///
+/// \tparam Types Types of the set.
+template <class... Types>
+class type_set {
+    typedef detail::type_set_table_holder<Types...> holder_t;
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+    static_assert(holder_t::value.valid, "====================> Boost.TypeIndex: type_set<Types...> requires unique types");
+#endif
+
+public:
+    /// Value that is returned for the types that are not in the set.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// \return Count of types in the set.
+    static constexpr std::size_t size() noexcept {
+        return sizeof...(Types);
+    }
+
+    /// \return Position of the type in the Types list or npos if the type is not in the set.
+    BOOST_CXX14_CONSTEXPR static std::size_t index_of(const ctti_type_index& type) noexcept {
+        const std::size_t slot = slot_of(type.fingerprint());
+        return holder_t::get().keys[slot] == type ? holder_t::get().indexes[slot] : npos;
+    }
+
+    /// \return Position of the type with the fingerprint in the Types list or npos if there is no such type in the set.
+    /// \param fingerprint Value returned by ctti_type_index::fingerprint().
+    BOOST_CXX14_CONSTEXPR static std::size_t index_of(std::uint64_t fingerprint) noexcept {
+        const std::size_t slot = slot_of(fingerprint);
+        return holder_t::get().keys[slot].fingerprint() == fingerprint ? holder_t::get().indexes[slot] : npos;
+    }
+
+    /// \return Position of the T in the Types list or npos if the T is not in the set.
+    template <class T>
+    BOOST_CXX14_CONSTEXPR static std::size_t index_of() noexcept {
+        return type_set::index_of(ctti_type_index::type_id<T>());
+    }
+
+    /// \return True if the type is in the set.
+    BOOST_CXX14_CONSTEXPR static bool contains(const ctti_type_index& type) noexcept {
+        return type_set::index_of(type) != npos;
+    }
+
+private:
+    BOOST_CXX14_CONSTEXPR static std::size_t slot_of(std::uint64_t fingerprint) noexcept {
+        return detail::type_set_slot(
+            fingerprint,
+            holder_t::get().seeds[detail::type_set_bucket(fingerprint, holder_t::size)],
+            holder_t::size
+        );
+    }
+};
+
+template <class... Types>
+constexpr std::size_t type_set<Types...>::npos;
+
+}} // namespace boost::typeindex
+
+#endif // BOOST_TYPE_INDEX_TYPE_SET_HPP
@@ -0,0 +1,222 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/ctti_type_index.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace my_namespace {
+    class my_class{};
+
+    template <class T>
+    struct outer {
+        struct inner {};
+    };
+}
+
+namespace {
+    struct anonymous_class {};
+}
+
+using boost::typeindex::ctti_type_index;
+using boost::typeindex::type_index;
+
+void algorithm() {
+    using boost::typeindex::detail::compact_type_name;
+
+    // __cxa_demangle style
+    BOOST_TEST_EQ(compact_type_name("std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >", false), "std::string");
+    BOOST_TEST_EQ(
+        compact_type_name("std::map<int, std::vector<int, std::allocator<int> >, std::less<int>, "
+                          "std::allocator<std::pair<int const, std::vector<int, std::allocator<int> > > > >", false),
+        "std::map<int, std::vector<int> >"
+    );
+    BOOST_TEST_EQ(
+        compact_type_name("std::unordered_map<int, a::B, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<int const, a::B> > >", false),
+        "std::unordered_map<int, a::B>"
+    );
+    BOOST_TEST_EQ(compact_type_name("std::priority_queue<int, std::vector<int, std::allocator<int> >, std::less<int> >", false), "std::priority_queue<int>");
+    BOOST_TEST_EQ(compact_type_name("std::unique_ptr<int [], std::default_delete<int []> >", false), "std::unique_ptr<int []>");
+    BOOST_TEST_EQ(compact_type_name("std::function<void (std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&)>", false),
+        "std::function<void (std::string const&)>"
+    );
+
+    // __PRETTY_FUNCTION__ style
+    BOOST_TEST_EQ(compact_type_name("std::__cxx11::basic_string<char>", false), "std::string");
+    BOOST_TEST_EQ(compact_type_name("std::__1::vector<std::__1::basic_string<wchar_t>>", false), "std::vector<std::wstring>");
+    BOOST_TEST_EQ(compact_type_name("std::basic_ostream<char>", false), "std::ostream");
+
+    // MSVC style
+    BOOST_TEST_EQ(
+        compact_type_name("class std::basic_string<char,struct std::char_traits<char>,class std::allocator<char> >", false),
+        "class std::string"
+    );
+    BOOST_TEST_EQ(
+        compact_type_name("class std::map<int,int,struct std::less<int>,class std::allocator<struct std::pair<int const ,int> > >", false),
+        "class std::map<int,int>"
+    );
+
+    // Non default arguments are kept
+    BOOST_TEST_EQ(compact_type_name("std::map<int, int, std::greater<int> >", false), "std::map<int, int, std::greater<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::set<int, std::less<void> >", false), "std::set<int, std::less<void> >");
+    BOOST_TEST_EQ(compact_type_name("std::vector<int, my::allocator<int> >", false), "std::vector<int, my::allocator<int> >");
+    BOOST_TEST_EQ(compact_type_name("my::vector<int, std::allocator<int> >", false), "my::vector<int, std::allocator<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::stack<int, std::vector<int> >", false), "std::stack<int, std::vector<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::pair<int, std::less<int> >", false), "std::pair<int, std::less<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::tuple<int, std::allocator<int> >", false), "std::tuple<int, std::allocator<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::tuple<int, std::hash<int>, std::equal_to<int> >", false), "std::tuple<int, std::hash<int>, std::equal_to<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::map<int, std::less<int> >", false), "std::map<int, std::less<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::set<int, std::allocator<int> >", false), "std::set<int, std::allocator<int> >");
+    BOOST_TEST_EQ(compact_type_name("std::unique_ptr<int, std::allocator<int> >", false), "std::unique_ptr<int, std::allocator<int> >");
+
+    // Namespaces
+    BOOST_TEST_EQ(compact_type_name("a::b::C<a::D, (anonymous namespace)::E>::F*", true), "C<D, E>::F*");
+    BOOST_TEST_EQ(compact_type_name("{anonymous}::A<`anonymous namespace'::B>", true), "A<B>");
+    BOOST_TEST_EQ(compact_type_name("std::vector<std::__cxx11::basic_string<char> > const&", true), "vector<string> const&");
+
+    // Not a type name
+    BOOST_TEST_EQ(compact_type_name("a<b", false), "a<b");
+    BOOST_TEST_EQ(compact_type_name("", false), "");
+}
+
+void normalization() {
+    using boost::typeindex::detail::normalize_type_name;
+
+    // Builtin types
+    BOOST_TEST_EQ(normalize_type_name("long unsigned int"), "unsigned long");
+    BOOST_TEST_EQ(normalize_type_name("short int*"), "short*");
+    BOOST_TEST_EQ(normalize_type_name("__int128 unsigned"), "unsigned __int128");
+    BOOST_TEST_EQ(normalize_type_name("unsigned __int64"), "unsigned long long");
+    BOOST_TEST_EQ(normalize_type_name("decltype(nullptr)"), "std::nullptr_t");
+    BOOST_TEST_EQ(normalize_type_name("my::long_name<signed_char>"), "my::long_name<signed_char>");
+
+    // Qualifiers
+    BOOST_TEST_EQ(normalize_type_name("const int"), "int const");
+    BOOST_TEST_EQ(normalize_type_name("const volatile long int&"), "long const volatile&");
+    BOOST_TEST_EQ(normalize_type_name("const std::vector<const int*>* const"), "std::vector<int const*> const* const");
+    BOOST_TEST_EQ(normalize_type_name("std::function<void(const char*, volatile int)>"), "std::function<void(char const*, int volatile)>");
+
+    // Spaces and anonymous namespaces
+    BOOST_TEST_EQ(normalize_type_name("void (*)(int)"), "void(*)(int)");
+    BOOST_TEST_EQ(normalize_type_name("int (*) [3]"), "int(*)[3]");
+    BOOST_TEST_EQ(normalize_type_name("int [2][3]"), "int [2][3]");
+    BOOST_TEST_EQ(normalize_type_name("a::B<a::C<int> >"), "a::B<a::C<int>>");
+    BOOST_TEST_EQ(normalize_type_name("{anonymous}::A<`anonymous namespace'::B>"), "(anonymous namespace)::A<(anonymous namespace)::B>");
+    BOOST_TEST_EQ(normalize_type_name("class std::map<int,struct A>"), "std::map<int, A>");
+    BOOST_TEST_EQ(normalize_type_name("char const *"), "char const*");
+
+    // Literals
+    BOOST_TEST_EQ(normalize_type_name("A<5ul, -1l, (short)5, (unsigned char)200>"), "A<5, -1, 5, 200>");
+    BOOST_TEST_EQ(normalize_type_name("A<'a', (char)97, '\\000', '\\n', '\\x7f'>"), "A<97, 97, 0, 10, 127>");
+    BOOST_TEST_EQ(normalize_type_name("A<(my::E)1, true, f(5u)>"), "A<(my::E)1, true, f(5u)>");
+
+    // Not a type name
+    BOOST_TEST_EQ(normalize_type_name("a<b"), "a<b");
+    BOOST_TEST_EQ(normalize_type_name(""), "");
+}
+
+template <class TypeIndex>
+void compact_names() {
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::string>().compact_name(), "std::string");
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::string>().short_name(), "string");
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::ostringstream>().compact_name(), "std::ostringstream");
+
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::vector<my_namespace::my_class> >().compact_name(), "std::vector<my_namespace::my_class>");
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::vector<my_namespace::my_class> >().short_name(), "vector<my_class>");
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::set<std::string> >().short_name(), "set<string>");
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::unique_ptr<int> >().short_name(), "unique_ptr<int>");
+
+    const std::string map_name = TypeIndex::template type_id<std::map<std::string, std::vector<int> > >().compact_name();
+    BOOST_TEST(map_name == "std::map<std::string, std::vector<int> >" || map_name == "std::map<std::string, std::vector<int>>");
+
+    BOOST_TEST_EQ(TypeIndex::template type_id<my_namespace::my_class>().compact_name(), TypeIndex::template type_id<my_namespace::my_class>().pretty_name());
+    BOOST_TEST_EQ(TypeIndex::template type_id<my_namespace::my_class>().short_name(), "my_class");
+    BOOST_TEST_EQ(TypeIndex::template type_id<anonymous_class>().short_name(), "anonymous_class");
+    BOOST_TEST_EQ(TypeIndex::template type_id<my_namespace::outer<int>::inner>().short_name(), "outer<int>::inner");
+    BOOST_TEST_EQ(TypeIndex::template type_id<int my_namespace::my_class::*>().short_name(), "int my_class::*");
+    BOOST_TEST_EQ(TypeIndex::template type_id<void (my_namespace::my_class::*)(int) const>().short_name(), "void (my_class::*)(int) const");
+    BOOST_TEST_EQ(TypeIndex::template type_id<int>().compact_name(), "int");
+    BOOST_TEST_EQ(TypeIndex::template type_id<int>().short_name(), "int");
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    const TypeIndex vector_index = TypeIndex::template type_id<std::vector<std::string> >();
+    BOOST_TEST(vector_index.compact_name_view() == vector_index.compact_name());
+    BOOST_TEST(vector_index.short_name_view() == "vector<string>");
+    BOOST_TEST(vector_index.normalized_name_view() == vector_index.normalized_name());
+
+    const TypeIndex map_index = TypeIndex::template type_id<std::map<std::string, short> >();
+    BOOST_TEST(map_index.normalized_name_view() == "std::map<std::string, short>");
+    BOOST_TEST(map_index.normalized_name_view() == map_index.normalized_name());
+    BOOST_TEST_EQ(map_index.normalized_fingerprint(), (TypeIndex::template type_id<std::map<std::string, short> >().normalized_fingerprint()));
+    BOOST_TEST_EQ(vector_index.compact_name_view().data(), vector_index.compact_name_view().data());
+#endif
+
+    BOOST_TEST_EQ(TypeIndex::template type_id<std::vector<unsigned long> >().normalized_name(), "std::vector<unsigned long>");
+    BOOST_TEST_EQ(TypeIndex::template type_id_with_cvr<const char*>().normalized_name(), "char const*");
+    BOOST_TEST_EQ((TypeIndex::template type_id<std::map<std::string, const int*> >().normalized_name()), "std::map<std::string, int const*>");
+    BOOST_TEST_EQ(TypeIndex::template type_id<anonymous_class>().normalized_name(), "(anonymous namespace)::anonymous_class");
+    BOOST_TEST_EQ(TypeIndex::template type_id<my_namespace::my_class>().normalized_name(), "my_namespace::my_class");
+    BOOST_TEST_EQ(
+        TypeIndex::template type_id<std::vector<short> >().normalized_fingerprint(),
+        TypeIndex::template type_id<std::vector<short> >().normalized_fingerprint()
+    );
+    BOOST_TEST_NE(
+        TypeIndex::template type_id<std::vector<short> >().normalized_fingerprint(),
+        TypeIndex::template type_id<std::vector<unsigned short> >().normalized_fingerprint()
+    );
+    BOOST_TEST_NE(
+        (TypeIndex::template type_id<std::pair<int, std::less<int> > >().normalized_fingerprint()),
+        (TypeIndex::template type_id<std::pair<int, int> >().normalized_fingerprint())
+    );
+    BOOST_TEST_NE(
+        (TypeIndex::template type_id<std::tuple<int, std::allocator<int> > >().normalized_fingerprint()),
+        TypeIndex::template type_id<std::tuple<int> >().normalized_fingerprint()
+    );
+    BOOST_TEST_NE(
+        (TypeIndex::template type_id<std::tuple<int, std::allocator<int> > >().compact_name()),
+        TypeIndex::template type_id<std::tuple<int> >().compact_name()
+    );
+}
+
+void constexpr_compact_names() {
+// Names are computed at compile time only with BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES.
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW) && defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+    constexpr std::string_view name = ctti_type_index::type_id<std::vector<std::string> >().compact_name_view();
+    static_assert(name == "std::vector<std::string>", "");
+
+    constexpr std::string_view short_name = ctti_type_index::type_id<std::vector<my_namespace::my_class> >().short_name_view();
+    static_assert(short_name == "vector<my_class>", "");
+
+    constexpr std::string_view member_pointer_name = ctti_type_index::type_id<int my_namespace::my_class::*>().short_name_view();
+    static_assert(member_pointer_name == "int my_class::*", "");
+
+    constexpr std::string_view normalized_name = ctti_type_index::type_id_with_cvr<const std::vector<unsigned long>&>().normalized_name_view();
+    static_assert(normalized_name == "std::vector<unsigned long> const&", "");
+#endif
+}
+
+int main() {
+    algorithm();
+    normalization();
+    compact_names<type_index>();
+    compact_names<ctti_type_index>();
+    constexpr_compact_names();
+
+    return boost::report_errors();
+}
@@ -9,6 +9,13 @@
 #include <boost/type_index/stl_type_index.hpp>
 #include <boost/core/lightweight_test.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 
 namespace my_namespace1 {
     class my_class{};
@@ -24,6 +31,29 @@ namespace my_namespace3
 template<typename T, typename U>
 struct my_template {};
 
+template <int I>
+struct int_tag {};
+
+template <unsigned long I>
+struct unsigned_long_tag {};
+
+template <char C>
+struct char_tag {};
+
+template <short S>
+struct short_tag {};
+
+enum class my_enum { a, b };
+
+template <my_enum E>
+struct enum_tag {};
+
+template <typename T, typename A = std::allocator<T> >
+struct my_vector {};
+}
+
+namespace {
+    struct anonymous_class {};
 }
 
 #if !defined( BOOST_NO_RTTI )
@@ -34,8 +64,27 @@ void compare()
     typedef boost::typeindex::ctti_type_index ctti;
     typedef boost::typeindex::stl_type_index stl;
     BOOST_TEST_EQ(
-        ctti::type_id<int>().pretty_name(),
-        stl::type_id<int>().pretty_name()
+        ctti::type_id_with_cvr<T>().normalized_name(),
+        stl::type_id_with_cvr<T>().normalized_name()
+    );
+    BOOST_TEST_EQ(
+        ctti::type_id_with_cvr<T>().normalized_fingerprint(),
+        stl::type_id_with_cvr<T>().normalized_fingerprint()
+    );
+}
+
+template<typename T>
+void compare_known_difference()
+{
+    typedef boost::typeindex::ctti_type_index ctti;
+    typedef boost::typeindex::stl_type_index stl;
+    BOOST_TEST_NE(
+        ctti::type_id_with_cvr<T>().normalized_name(),
+        stl::type_id_with_cvr<T>().normalized_name()
+    );
+    BOOST_TEST_NE(
+        ctti::type_id_with_cvr<T>().normalized_fingerprint(),
+        stl::type_id_with_cvr<T>().normalized_fingerprint()
     );
 }
 
@@ -52,6 +101,47 @@ int main()
             my_namespace1::my_class,
             my_namespace2::my_class> >();
 
+    // Builtin types are spelled differently by the compiler and the demangler
+    compare<short>();
+    compare<unsigned short>();
+    compare<long>();
+    compare<unsigned long>();
+    compare<long long>();
+    compare<unsigned long long>();
+    compare<signed char>();
+    compare<long double>();
+    compare<std::nullptr_t>();
+
+    // Position of the cv-qualifiers
+    compare<const int>();
+    compare<const volatile int>();
+    compare<const int*>();
+    compare<const int* const*>();
+    compare<const std::vector<int>*>();
+    compare<const int[3]>();
+    compare<std::map<const char*, std::vector<const int*> > >();
+
+    // Function types, arrays and anonymous namespaces
+    compare<void(int)>();
+    compare<void(*)(int)>();
+    compare<int(*)[3]>();
+    compare<int[2][3]>();
+    compare<std::function<int(const std::string&, short)> >();
+    compare<anonymous_class>();
+    compare<my_namespace3::my_template<anonymous_class, const anonymous_class*> >();
+
+    // Literals
+    compare<my_namespace3::int_tag<-5> >();
+    compare<my_namespace3::unsigned_long_tag<7> >();
+    compare<my_namespace3::char_tag<'a'> >();
+    compare<my_namespace3::char_tag<'\0'> >();
+    compare<my_namespace3::short_tag<5> >();
+
+    // Known differences: enumerators are spelled as `E::a` by the compiler and as `(E)0` by the demangler,
+    // defaulted arguments of user templates are omitted by the compiler.
+    compare_known_difference<my_namespace3::enum_tag<my_namespace3::my_enum::a> >();
+    compare_known_difference<my_namespace3::my_vector<int> >();
+
 
     return boost::report_errors();
 }
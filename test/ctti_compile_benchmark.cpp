@@ -0,0 +1,49 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * is a compile time benchmark: it instantiates ctti_type_index for 1000 class template instantiations
+//   with names of typical length. The test suite builds it with -ftime-report on GCC and Clang, which
+//   outputs the compilation time and the memory consumption. Alternatively measure the compiler with
+//   `/usr/bin/time -v`.
+// * define BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES to measure the compile time computation of the compact names, or
+//   BOOST_TYPE_INDEX_CTTI_UNTRIMMED_NAMES to measure the mode without compile time names computation.
+
+#include <boost/type_index/ctti_type_index.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace my_namespace {
+    template <int I>
+    struct some_type_with_a_name {};
+}
+
+using boost::typeindex::ctti_type_index;
+
+// Sums hashes of the std::map<std::string, std::vector<some_type_with_a_name<I>>> for I in [Begin, End),
+// splitting the range in halves to keep the instantiation depth low
+template <int Begin, int End, bool Single = (End - Begin == 1)>
+struct hash_types {
+    static std::size_t apply() {
+        return hash_types<Begin, (Begin + End) / 2>::apply() + hash_types<(Begin + End) / 2, End>::apply();
+    }
+};
+
+template <int Begin, int End>
+struct hash_types<Begin, End, true> {
+    static std::size_t apply() {
+        return ctti_type_index::type_id<
+            std::map<std::string, std::vector<my_namespace::some_type_with_a_name<Begin> > >
+        >().hash_code();
+    }
+};
+
+int main() {
+    return hash_types<0, 1000>::apply() == 0;
+}
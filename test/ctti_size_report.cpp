@@ -0,0 +1,132 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * tests that all the names of a ctti_type_index are consistent and zero terminated if computed at compile time
+// * outputs the count of bytes that the type information of ctti_type_index occupies in the binary.
+//   Build it with BOOST_TYPE_INDEX_CTTI_COMPACT_NAMES, without macros and with BOOST_TYPE_INDEX_CTTI_UNTRIMMED_NAMES
+//   to compare the emission modes.
+
+#include <boost/type_index/ctti_type_index.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace my_namespace {
+    class my_class{};
+
+    template <int I>
+    struct some_type_with_a_name {};
+}
+
+namespace {
+    struct anonymous_class {};
+}
+
+using boost::typeindex::ctti_type_index;
+using boost::typeindex::detail::ctti_entry;
+
+// Adds some_type_with_a_name<Begin> ... some_type_with_a_name<End - 1>, splitting the range in halves to keep the instantiation depth low
+template <int Begin, int End, bool Single = (End - Begin == 1)>
+struct add_types {
+    static void apply(std::vector<ctti_type_index>& types) {
+        add_types<Begin, (Begin + End) / 2>::apply(types);
+        add_types<(Begin + End) / 2, End>::apply(types);
+    }
+};
+
+template <int Begin, int End>
+struct add_types<Begin, End, true> {
+    static void apply(std::vector<ctti_type_index>& types) {
+        types.push_back(ctti_type_index::type_id<my_namespace::some_type_with_a_name<Begin> >());
+    }
+};
+
+const ctti_entry& entry(const ctti_type_index& index) {
+    return reinterpret_cast<const ctti_entry&>(index.type_info());
+}
+
+// Bytes of the array that contains the names of the type
+std::size_t names_size(const ctti_type_index& index) {
+    const ctti_entry& e = entry(index);
+    if (e.compact_offset == boost::typeindex::detail::ctti_no_offset) {
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+        // Array with the trimmed name
+        return e.size + 1;
+#elif defined(BOOST_TYPE_INDEX_DETAIL_CTTI_SIGNATURE_COPY) || (!defined(__clang__) && defined(__GNUC__) && !defined(BOOST_NO_CXX14_CONSTEXPR))
+        // Array with the ending of the function signature
+        return std::strlen(e.name) + 1;
+#else
+        // Whole function signature
+        return boost::typeindex::detail::skip().size_at_begin + std::strlen(e.name) + 1;
+#endif
+    }
+
+    std::size_t size = e.size + 1;
+    const std::size_t ends[] = {
+        e.compact_offset + e.compact_size + 1, e.short_offset + e.short_size + 1, e.normalized_offset + e.normalized_size + 1
+    };
+    for (std::size_t i = 0; i < sizeof(ends) / sizeof(ends[0]); ++i) {
+        size = (ends[i] > size ? ends[i] : size);
+    }
+    return size;
+}
+
+void check_names(const ctti_type_index& index) {
+    BOOST_TEST_EQ(index.compact_name(), boost::typeindex::detail::compact_type_name(index.pretty_name(), false));
+    BOOST_TEST_EQ(index.short_name(), boost::typeindex::detail::compact_type_name(index.pretty_name(), true));
+    BOOST_TEST_EQ(index.normalized_name(), boost::typeindex::detail::normalize_type_name(index.compact_name()));
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+    // All the names are zero terminated arrays in the binary
+    const ctti_entry& e = entry(index);
+    BOOST_TEST_EQ(std::strlen(e.name), e.size);
+#endif
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+    BOOST_TEST_EQ(std::strlen(e.name + e.compact_offset), e.compact_size);
+    BOOST_TEST_EQ(std::strlen(e.name + e.short_offset), e.short_size);
+    BOOST_TEST_EQ(std::strlen(e.name + e.normalized_offset), e.normalized_size);
+#endif
+}
+
+int main() {
+    std::vector<ctti_type_index> types;
+    add_types<0, 200>::apply(types);
+    types.push_back(ctti_type_index::type_id<my_namespace::my_class>());
+    types.push_back(ctti_type_index::type_id<anonymous_class>());
+    types.push_back(ctti_type_index::type_id<std::string>());
+    types.push_back(ctti_type_index::type_id<std::vector<std::string> >());
+    types.push_back(ctti_type_index::type_id<std::map<std::string, std::vector<int> > >());
+    types.push_back(ctti_type_index::type_id_with_cvr<const volatile long&>());
+
+    std::size_t names = 0;
+    std::size_t pretty_names = 0;
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        check_names(types[i]);
+        names += names_size(types[i]);
+        pretty_names += entry(types[i]).size + 1;
+    }
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_COMPACT_NAMES)
+    const char* const mode = "trimmed and compact names";
+#elif defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+    const char* const mode = "trimmed names";
+#else
+    const char* const mode = "untrimmed names";
+#endif
+    std::cout << "Emission mode: " << mode << ", " << types.size() << " types\n"
+        << "  names storage:        " << names << " bytes (" << names / types.size() << " per type)\n"
+        << "  pretty_name() only:   " << pretty_names << " bytes (" << pretty_names / types.size() << " per type)\n"
+        << "  entry:                " << sizeof(ctti_entry) << " bytes per type, 1 pointer to relocate\n"
+        << "  compile time names:   " << (entry(types[0]).compact_offset != boost::typeindex::detail::ctti_no_offset ? "yes" : "no") << '\n';
+
+    return boost::report_errors();
+}
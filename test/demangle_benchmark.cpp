@@ -0,0 +1,100 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * outputs the time of demangling by the boost::core::demangle() and by the boost::typeindex::demangle_type_name().
+//   Correctness of the latter is tested in demangle_test.cpp
+
+#include <boost/type_index/demangle.hpp>
+#include <boost/core/demangle.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_NO_RTTI)
+#include <boost/type_index/stl_type_index.hpp>
+#endif
+
+namespace some_namespace {
+    struct some_class {
+        void method(int) const {}
+    };
+    template <class T, int I, bool B>
+    struct some_template {};
+
+    template <class... T>
+    struct some_pack {};
+}
+
+namespace {
+    struct anonymous_class {};
+}
+
+#if !defined(BOOST_NO_RTTI)
+
+typedef boost::typeindex::stl_type_index stl_type_index;
+
+std::vector<stl_type_index> make_types() {
+    std::vector<stl_type_index> types;
+    types.push_back(stl_type_index::type_id<int>());
+    types.push_back(stl_type_index::type_id<std::string>());
+    types.push_back(stl_type_index::type_id_with_cvr<const std::string&>());
+    types.push_back(stl_type_index::type_id<std::map<std::string, std::vector<int> > >());
+    types.push_back(stl_type_index::type_id<some_namespace::some_template<std::map<int, std::string>, -1, true> >());
+    types.push_back(stl_type_index::type_id_with_cvr<volatile some_namespace::some_template<int, 2, false>&&>());
+    types.push_back(stl_type_index::type_id<some_namespace::some_pack<> >());
+    types.push_back(stl_type_index::type_id<some_namespace::some_pack<int, some_namespace::some_pack<> > >());
+    types.push_back(stl_type_index::type_id<void (some_namespace::some_class::*)(int) const>());
+    types.push_back(stl_type_index::type_id<int (*(*)[3])(const char*, ...)>());
+    types.push_back(stl_type_index::type_id<anonymous_class>());
+    types.push_back(stl_type_index::type_id<const anonymous_class* volatile*>());
+    return types;
+}
+
+template <class Namer>
+double measure(const std::vector<stl_type_index>& types, Namer namer) {
+    const std::size_t iterations = 100000;
+    std::size_t result = 0;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        result += namer(types[i % types.size()]);
+    }
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    BOOST_TEST(result != 0);
+    return std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+}
+
+struct core_demangle_namer {
+    std::size_t operator()(const stl_type_index& t) const {
+        return boost::core::demangle(t.type_info().name()).size();
+    }
+};
+
+struct builtin_demangle_namer {
+    std::size_t operator()(const stl_type_index& t) const {
+        char buffer[512];
+        return boost::typeindex::demangle_type_name(t.type_info().name(), buffer, sizeof(buffer)).size;
+    }
+};
+
+#endif // !defined(BOOST_NO_RTTI)
+
+int main() {
+#if !defined(BOOST_NO_RTTI)
+    const std::vector<stl_type_index> types = make_types();
+    std::cout << "boost::core::demangle() " << measure(types, core_demangle_namer()) << "ns, "
+        << "boost::typeindex::demangle_type_name() " << measure(types, builtin_demangle_namer()) << "ns\n";
+#endif
+
+    return boost::report_errors();
+}
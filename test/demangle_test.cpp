@@ -0,0 +1,194 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * tests that the boost::typeindex::demangle_type_name() gives the same results as the boost::core::demangle()
+// * tests the error codes of the boost::typeindex::demangle_type_name()
+
+#include <boost/type_index/demangle.hpp>
+#include <boost/core/demangle.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_NO_RTTI)
+#include <boost/type_index/stl_type_index.hpp>
+#endif
+
+using boost::typeindex::demangle_result;
+using boost::typeindex::demangle_status;
+using boost::typeindex::demangle_type_name;
+
+namespace some_namespace {
+    struct some_class {
+        void method(int) const {}
+    };
+    template <class T, int I, bool B>
+    struct some_template {};
+
+    template <class... T>
+    struct some_pack {};
+}
+
+namespace {
+    struct anonymous_class {};
+}
+
+std::string demangle_to_string(const char* name) {
+    char buffer[512];
+    const demangle_result result = demangle_type_name(name, buffer, sizeof(buffer));
+    BOOST_TEST(result.status == demangle_status::success);
+    return std::string(buffer, result.size);
+}
+
+void error_codes() {
+    char buffer[256];
+    BOOST_TEST(demangle_type_name("", buffer, sizeof(buffer)).status == demangle_status::invalid_name);
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES)
+    BOOST_TEST(demangle_type_name("N3foo", buffer, sizeof(buffer)).status == demangle_status::invalid_name);
+    BOOST_TEST(demangle_type_name("3fooE", buffer, sizeof(buffer)).status == demangle_status::invalid_name);
+    BOOST_TEST(demangle_type_name("St6vectorIiS0_E", buffer, sizeof(buffer)).status == demangle_status::invalid_name);
+    BOOST_TEST(demangle_type_name("PT_", buffer, sizeof(buffer)).status == demangle_status::unsupported);
+    BOOST_TEST(demangle_type_name("1AIXadL_Z3foovEEE", buffer, sizeof(buffer)).status == demangle_status::unsupported);
+
+    std::string deep(1000, 'P');
+    deep += 'i';
+    BOOST_TEST(demangle_type_name(deep.c_str(), buffer, sizeof(buffer)).status == demangle_status::too_complex);
+
+    // Nesting that would exhaust the stack without the depth limit
+    std::string very_deep(200000, 'P');
+    very_deep += 'i';
+    BOOST_TEST(demangle_type_name(very_deep.c_str(), buffer, sizeof(buffer)).status == demangle_status::too_complex);
+
+    std::string deep_pack = "1AI";
+    deep_pack.append(200000, 'J');
+    BOOST_TEST(demangle_type_name(deep_pack.c_str(), buffer, sizeof(buffer)).status == demangle_status::too_complex);
+
+    std::string deep_local(200000, 'Z');
+    deep_local += 'i';
+    BOOST_TEST(demangle_type_name(deep_local.c_str(), buffer, sizeof(buffer)).status == demangle_status::too_complex);
+
+    const char vector_name[] = "St6vectorIiSaIiEE";
+    const std::string expected = "std::vector<int, std::allocator<int> >";
+    demangle_result result = demangle_type_name(vector_name, buffer, 4);
+    BOOST_TEST(result.status == demangle_status::buffer_too_small);
+    BOOST_TEST_EQ(result.size, expected.size() + 1);
+
+    result = demangle_type_name(vector_name, buffer, expected.size());
+    BOOST_TEST(result.status == demangle_status::buffer_too_small);
+
+    result = demangle_type_name(vector_name, buffer, expected.size() + 1);
+    BOOST_TEST(result.status == demangle_status::success);
+    BOOST_TEST_EQ(result.size, expected.size());
+    BOOST_TEST_EQ(std::string(buffer), expected);
+#endif
+}
+
+void known_names() {
+#if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES)
+    BOOST_TEST_EQ(demangle_to_string("i"), "int");
+    BOOST_TEST_EQ(demangle_to_string("PKc"), "char const*");
+    BOOST_TEST_EQ(demangle_to_string("PA3_i"), "int (*) [3]");
+    BOOST_TEST_EQ(demangle_to_string("A2_A3_i"), "int [2][3]");
+    BOOST_TEST_EQ(demangle_to_string("PKPFviE"), "void (* const*)(int)");
+    BOOST_TEST_EQ(demangle_to_string("FvvE"), "void ()");
+    BOOST_TEST_EQ(demangle_to_string("PDoFvvE"), "void (*)() noexcept");
+    BOOST_TEST_EQ(demangle_to_string("M1AKFviE"), "void (A::*)(int) const");
+    BOOST_TEST_EQ(demangle_to_string("M1Ai"), "int A::*");
+    BOOST_TEST_EQ(demangle_to_string("St4pairIiS_IccEE"), "std::pair<int, std::pair<char, char> >");
+    BOOST_TEST_EQ(demangle_to_string("N2ns1BILi5ELb1ELin2ELm3EEE"), "ns::B<5, true, -2, 3ul>");
+    BOOST_TEST_EQ(demangle_to_string("N2ns1BIJEEE"), "ns::B<>");
+    BOOST_TEST_EQ(demangle_to_string("N12_GLOBAL__N_14anonE"), "(anonymous namespace)::anon");
+    BOOST_TEST_EQ(demangle_to_string("Z4mainE5Local"), "main::Local");
+    BOOST_TEST_EQ(demangle_to_string("ZN2ns1A1fEvEUliE0_"), "ns::A::f()::{lambda(int)#2}");
+    BOOST_TEST_EQ(demangle_to_string("N2ns3TagB5cxx11E"), "ns::Tag[abi:cxx11]");
+
+    // cvr_saver is removed
+    BOOST_TEST_EQ(demangle_to_string("N5boost9typeindex6detail9cvr_saverIKiEE"), "int const");
+    BOOST_TEST_EQ(
+        demangle_to_string("N5boost9typeindex6detail9cvr_saverIRKSt6vectorIiSaIiEEEE"),
+        "std::vector<int, std::allocator<int> > const&"
+    );
+#endif
+}
+
+#if !defined(BOOST_NO_RTTI)
+
+typedef boost::typeindex::stl_type_index stl_type_index;
+
+std::vector<stl_type_index> make_types() {
+    std::vector<stl_type_index> types;
+    types.push_back(stl_type_index::type_id<int>());
+    types.push_back(stl_type_index::type_id<std::string>());
+    types.push_back(stl_type_index::type_id_with_cvr<const std::string&>());
+    types.push_back(stl_type_index::type_id<std::map<std::string, std::vector<int> > >());
+    types.push_back(stl_type_index::type_id<some_namespace::some_template<std::map<int, std::string>, -1, true> >());
+    types.push_back(stl_type_index::type_id_with_cvr<volatile some_namespace::some_template<int, 2, false>&&>());
+    types.push_back(stl_type_index::type_id<some_namespace::some_pack<> >());
+    types.push_back(stl_type_index::type_id<some_namespace::some_pack<int, some_namespace::some_pack<> > >());
+    types.push_back(stl_type_index::type_id<void (some_namespace::some_class::*)(int) const>());
+    types.push_back(stl_type_index::type_id<int (*(*)[3])(const char*, ...)>());
+    types.push_back(stl_type_index::type_id<anonymous_class>());
+    types.push_back(stl_type_index::type_id<const anonymous_class* volatile*>());
+    return types;
+}
+
+void same_as_pretty_name(const std::vector<stl_type_index>& types) {
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        BOOST_TEST_EQ(demangle_to_string(types[i].type_info().name()), types[i].pretty_name());
+    }
+}
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES) && defined(__GLIBCXX__)
+std::string core_demangle(const char* name) {
+    const std::string demangled = boost::core::demangle(name);
+    const char* begin = demangled.c_str();
+    const char* end = begin + demangled.size();
+    boost::typeindex::detail::strip_cvr_saver(begin, end);
+    return std::string(begin, end);
+}
+#endif
+
+void same_as_core_demangle(const std::vector<stl_type_index>& types) {
+    // The built-in demangler reproduces the output of the libstdc++ __cxa_demangle
+#if defined(BOOST_TYPE_INDEX_DETAIL_ITANIUM_NAMES) && defined(__GLIBCXX__)
+    char buffer[512];
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        const std::string name = types[i].type_info().name();
+        BOOST_TEST_EQ(demangle_to_string(name.c_str()), core_demangle(name.c_str()));
+
+        // Prefixes of the mangled names are either invalid or demangled in the same way
+        for (std::size_t size = 0; size < name.size(); ++size) {
+            const std::string prefix = name.substr(0, size);
+            const demangle_result result = demangle_type_name(prefix.c_str(), buffer, sizeof(buffer));
+            if (result.status == demangle_status::success) {
+                BOOST_TEST_EQ(std::string(buffer), core_demangle(prefix.c_str()));
+            }
+        }
+    }
+#else
+    (void)types;
+#endif
+}
+
+#endif // !defined(BOOST_NO_RTTI)
+
+int main() {
+    error_codes();
+    known_names();
+
+#if !defined(BOOST_NO_RTTI)
+    const std::vector<stl_type_index> types = make_types();
+    same_as_pretty_name(types);
+    same_as_core_demangle(types);
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,195 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/config.hpp>
+
+#if defined(__has_include)
+#  if __has_include(<fmt/format.h>)
+#    define FMT_HEADER_ONLY
+#    include <fmt/format.h>
+#  endif
+#endif
+
+#include <boost/type_index.hpp>
+#include <boost/type_index/ctti_type_index.hpp>
+#include <boost/type_index/formatter.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+    std::size_t allocations = 0;
+}
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+// Not inlined to avoid the GCC false positive -Wmismatched-new-delete warnings
+BOOST_NOINLINE void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+BOOST_NOINLINE void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace my_namespace {
+    class my_class{};
+
+    struct names_info {
+        const char* raw;
+        const char* pretty;
+    };
+
+    // Redefines pretty_name() and does not redefine pretty_name_view()
+    class names_index: public boost::typeindex::type_index_facade<names_index, names_info> {
+        const names_info* data_;
+
+    public:
+        typedef names_info type_info_t;
+
+        explicit names_index(const type_info_t& data) noexcept
+            : data_(&data)
+        {}
+
+        const type_info_t& type_info() const noexcept { return *data_; }
+        const char* raw_name() const noexcept { return data_->raw; }
+        std::string pretty_name() const { return data_->pretty; }
+    };
+}
+
+using boost::typeindex::ctti_type_index;
+using boost::typeindex::type_index;
+
+// Stream buffer over a fixed array, so that the output itself does not allocate memory
+class fixed_buffer: public std::streambuf {
+public:
+    fixed_buffer() {
+        setp(data_, data_ + sizeof(data_));
+    }
+
+    std::string str() const {
+        return std::string(pbase(), pptr());
+    }
+
+private:
+    char data_[512];
+};
+
+template <class TypeIndex>
+void stream_output() {
+    const TypeIndex index = TypeIndex::template type_id<std::vector<my_namespace::my_class> >();
+
+    std::ostringstream ss;
+    ss << index;
+    BOOST_TEST_EQ(ss.str(), index.pretty_name());
+
+    std::ostringstream right;
+    right << std::setw(40) << std::setfill('.') << TypeIndex::template type_id<int>() << '|';
+    BOOST_TEST_EQ(right.str(), std::string(37, '.') + "int|");
+
+    std::ostringstream left;
+    left << std::left << std::setw(5) << TypeIndex::template type_id<int>() << '|' << TypeIndex::template type_id<int>();
+    BOOST_TEST_EQ(left.str(), "int  |int");
+
+    fixed_buffer buffer;
+    std::ostream out(&buffer);
+    out << index; // warming up the caches
+    const std::size_t before = allocations;
+    out << ' ' << index;
+    BOOST_TEST_EQ(allocations, before);
+    BOOST_TEST_EQ(buffer.str(), index.pretty_name() + ' ' + index.pretty_name());
+}
+
+template <class TypeIndex>
+void fmt_output() {
+#if defined(FMT_VERSION) && !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+    const TypeIndex index = TypeIndex::template type_id<std::vector<std::string> >();
+    BOOST_TEST_EQ(fmt::format("{}", index), index.pretty_name());
+    BOOST_TEST_EQ(fmt::format("{:p}", index), index.pretty_name());
+    BOOST_TEST_EQ(fmt::format("{:r}", index), index.raw_name());
+    BOOST_TEST_EQ(fmt::format("{:c}", index), index.compact_name());
+    BOOST_TEST_EQ(fmt::format("{:s}", index), index.short_name());
+    BOOST_TEST_EQ(fmt::format("{:n}", index), index.normalized_name());
+    BOOST_TEST_EQ(fmt::format("{:f}", index), fmt::format("{:016x}", index.fingerprint()));
+    BOOST_TEST_THROWS((void)fmt::format(fmt::runtime("{:x}"), index), fmt::format_error);
+    BOOST_TEST_THROWS((void)fmt::format(fmt::runtime("{:pp}"), index), fmt::format_error);
+
+    char buffer[512];
+    (void)fmt::format_to(buffer, "{:c}{:n}", index, index); // warming up the caches
+    const std::size_t before = allocations;
+    char* const end = fmt::format_to(buffer, "{} {:c} {:s} {:n} {:f}", index, index, index, index, index);
+    BOOST_TEST_EQ(allocations, before);
+    BOOST_TEST_EQ(
+        std::string(buffer, end),
+        index.pretty_name() + ' ' + index.compact_name() + ' ' + index.short_name() + ' ' + index.normalized_name()
+            + ' ' + fmt::format("{:016x}", index.fingerprint())
+    );
+#endif
+}
+
+template <class TypeIndex>
+void std_format_output() {
+#ifdef BOOST_TYPE_INDEX_DETAIL_HAS_STD_FORMAT
+    const TypeIndex index = TypeIndex::template type_id<std::vector<std::string> >();
+    BOOST_TEST_EQ(std::format("{}", index), index.pretty_name());
+    BOOST_TEST_EQ(std::format("{:r}", index), index.raw_name());
+    BOOST_TEST_EQ(std::format("{:c}", index), index.compact_name());
+    BOOST_TEST_EQ(std::format("{:s}", index), index.short_name());
+    BOOST_TEST_EQ(std::format("{:n}", index), index.normalized_name());
+    BOOST_TEST_EQ(std::format("{:f}", index), std::format("{:016x}", index.fingerprint()));
+
+    char buffer[512];
+    (void)std::format_to(buffer, "{:c}{:n}", index, index); // warming up the caches
+    const std::size_t before = allocations;
+    char* const end = std::format_to(buffer, "{} {:c}", index, index);
+    BOOST_TEST_EQ(allocations, before);
+    BOOST_TEST_EQ(std::string(buffer, end), index.pretty_name() + ' ' + index.compact_name());
+#endif
+}
+
+void redefined_pretty_name() {
+    const my_namespace::names_info info = {"i", "int"};
+    const my_namespace::names_index index(info);
+
+    std::ostringstream ss;
+    ss << index;
+    BOOST_TEST_EQ(ss.str(), "int");
+
+#if defined(FMT_VERSION) && !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+    BOOST_TEST_EQ(fmt::format("{}", index), ss.str());
+    BOOST_TEST_EQ(fmt::format("{:r}", index), "i");
+#endif
+#ifdef BOOST_TYPE_INDEX_DETAIL_HAS_STD_FORMAT
+    BOOST_TEST_EQ(std::format("{}", index), ss.str());
+#endif
+}
+
+int main() {
+    stream_output<type_index>();
+    stream_output<ctti_type_index>();
+    fmt_output<type_index>();
+    fmt_output<ctti_type_index>();
+    std_format_output<type_index>();
+    std_format_output<ctti_type_index>();
+    redefined_pretty_name();
+
+    return boost::report_errors();
+}
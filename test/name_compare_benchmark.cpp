@@ -0,0 +1,110 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * tests that the vectorized names comparison gives the same results as the std::strcmp
+// * outputs the time of names comparisons for names with long common prefixes
+
+#include <boost/type_index/detail/compile_time_type_info.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using boost::typeindex::detail::constexpr_name_compare;
+using boost::typeindex::detail::constexpr_strcmp_loop;
+
+int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+// Names of template instantiations that differ only in the last characters
+std::vector<std::string> make_names(std::size_t size) {
+    std::string prefix = "some_namespace::some_template<";
+    while (prefix.size() < size) {
+        prefix += "other_namespace::other_template<";
+    }
+    prefix.resize(size - 2);
+
+    std::vector<std::string> names;
+    for (char c = 'a'; c < 'i'; ++c) {
+        names.push_back(prefix + c + '>');
+    }
+    return names;
+}
+
+void compare_same_as_strcmp(const std::vector<std::string>& names) {
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        for (std::size_t j = 0; j < names.size(); ++j) {
+            const std::string& l = names[i];
+            const std::string& r = names[j];
+            BOOST_TEST_EQ(
+                sign(constexpr_name_compare(l.c_str(), l.size(), r.c_str(), r.size())),
+                sign(std::strcmp(l.c_str(), r.c_str()))
+            );
+
+            // Prefixes
+            for (std::size_t k = 0; k < l.size(); k += 7) {
+                BOOST_TEST_EQ(
+                    sign(constexpr_name_compare(l.c_str(), k, r.c_str(), r.size())),
+                    sign(std::strcmp(l.substr(0, k).c_str(), r.c_str()))
+                );
+            }
+        }
+    }
+}
+
+template <class Comparator>
+double measure(const std::vector<std::string>& names, Comparator comparator) {
+    const std::size_t iterations = 20000;
+    int result = 0;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        result += sign(comparator(names[i % names.size()], names[(i + 1) % names.size()]));
+    }
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    BOOST_TEST(result != 0);
+    return std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+}
+
+struct loop_comparator {
+    int operator()(const std::string& l, const std::string& r) const noexcept {
+        return constexpr_strcmp_loop(l.c_str(), r.c_str());
+    }
+};
+
+struct strcmp_comparator {
+    int operator()(const std::string& l, const std::string& r) const noexcept {
+        return std::strcmp(l.c_str(), r.c_str());
+    }
+};
+
+struct name_comparator {
+    int operator()(const std::string& l, const std::string& r) const noexcept {
+        return constexpr_name_compare(l.c_str(), l.size(), r.c_str(), r.size());
+    }
+};
+
+int main() {
+    const std::size_t sizes[] = {50, 100, 250, 500, 1000, 2000};
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        const std::vector<std::string> names = make_names(sizes[i]);
+        compare_same_as_strcmp(names);
+
+        std::cout << "Name length " << sizes[i] << ": "
+            << "constexpr_strcmp_loop " << measure(names, loop_comparator()) << "ns, "
+            << "std::strcmp " << measure(names, strcmp_comparator()) << "ns, "
+            << "constexpr_name_compare " << measure(names, name_comparator()) << "ns\n";
+    }
+
+    return boost::report_errors();
+}
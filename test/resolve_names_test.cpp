@@ -0,0 +1,124 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/resolve_names.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace my_namespace {
+    class my_class{};
+    template <int I> struct tag{};
+}
+
+using boost::typeindex::type_index;
+using boost::typeindex::resolved_names;
+
+// Adds tag<Begin> ... tag<End - 1>, splitting the range in halves to keep the instantiation depth low
+template <int Begin, int End, bool Single = (End - Begin == 1)>
+struct add_tags {
+    static void apply(std::vector<type_index>& types) {
+        add_tags<Begin, (Begin + End) / 2>::apply(types);
+        add_tags<(Begin + End) / 2, End>::apply(types);
+    }
+};
+
+template <int Begin, int End>
+struct add_tags<Begin, End, true> {
+    static void apply(std::vector<type_index>& types) {
+        types.push_back(type_index::type_id<my_namespace::tag<Begin> >());
+    }
+};
+
+void check_names(const std::vector<type_index>& types, const resolved_names& names) {
+    BOOST_TEST_EQ(names.size(), types.size());
+    BOOST_TEST_EQ(names.offsets().size(), names.unique_size() + 1);
+    BOOST_TEST_EQ(names.offsets().back(), names.arena().size());
+
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        BOOST_TEST_EQ(names.c_str(i), types[i].pretty_name());
+        BOOST_TEST_EQ(names.name_size(i), std::strlen(names.c_str(i)));
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+        BOOST_TEST(names[i] == types[i].pretty_name_view());
+#endif
+    }
+
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        for (std::size_t j = 0; j < types.size(); ++j) {
+            BOOST_TEST_EQ(names.unique_index(i) == names.unique_index(j), types[i] == types[j]);
+        }
+    }
+}
+
+void small_input() {
+    std::vector<type_index> types;
+    types.push_back(type_index::type_id<int>());
+    types.push_back(type_index::type_id<my_namespace::my_class>());
+    types.push_back(type_index::type_id<int>());
+    types.push_back(type_index::type_id<std::string>());
+    types.push_back(type_index::type_id_with_cvr<const int&>());
+    types.push_back(type_index::type_id<my_namespace::my_class>());
+
+    resolved_names names;
+    boost::typeindex::resolve_names(types, names);
+    check_names(types, names);
+    BOOST_TEST_EQ(names.unique_size(), 4u);
+    BOOST_TEST_EQ(names.unique_index(0), 0u);
+    BOOST_TEST_EQ(names.unique_index(1), 1u);
+    BOOST_TEST_EQ(names.unique_index(2), 0u);
+    BOOST_TEST_EQ(names.unique_index(3), 2u);
+    BOOST_TEST_EQ(names.unique_index(4), 3u);
+    BOOST_TEST_EQ(names.unique_index(5), 1u);
+    BOOST_TEST_EQ(names.c_str(0), names.c_str(2));
+
+    // Output is reused
+    types.resize(1);
+    boost::typeindex::resolve_names(types.data(), types.size(), names);
+    check_names(types, names);
+    BOOST_TEST_EQ(names.unique_size(), 1u);
+}
+
+void empty_input() {
+    const std::vector<type_index> types;
+    resolved_names names;
+    boost::typeindex::resolve_names(types, names);
+    BOOST_TEST_EQ(names.size(), 0u);
+    BOOST_TEST_EQ(names.unique_size(), 0u);
+    BOOST_TEST(names.arena().empty());
+}
+
+void big_input() {
+    std::vector<type_index> types;
+    add_tags<0, 1000>::apply(types);
+    add_tags<500, 700>::apply(types);
+    types.push_back(type_index::type_id<int>());
+
+    for (std::size_t threads = 1; threads <= 5; ++threads) {
+        resolved_names names;
+        boost::typeindex::resolve_names(types, names, threads);
+        BOOST_TEST_EQ(names.unique_size(), 1001u);
+        check_names(types, names);
+    }
+
+    resolved_names names;
+    boost::typeindex::resolve_names(types, names);
+    BOOST_TEST_EQ(names.unique_size(), 1001u);
+    BOOST_TEST_EQ(names.c_str(0), type_index::type_id<my_namespace::tag<0> >().pretty_name());
+    BOOST_TEST_EQ(names.c_str(500), names.c_str(1000));
+    BOOST_TEST_EQ(names.unique_index(1200), 1000u);
+}
+
+int main() {
+    small_input();
+    empty_input();
+    big_input();
+
+    return boost::report_errors();
+}
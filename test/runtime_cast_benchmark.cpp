@@ -0,0 +1,188 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * tests boost::typeindex::runtime_cast to final classes and boost::typeindex::exact_runtime_cast in a deep hierarchy
+// * outputs the time of those casts, of the runtime_cast to a non final class and of the dynamic_cast if RTTI is on
+// * outputs the time per object of boost::typeindex::runtime_filter_cast and of the same loops with single casts
+
+#include <boost/type_index/runtime_cast.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace some_long_namespace_name {
+    template <int I>
+    struct level;
+
+    template <>
+    struct level<0> {
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+        virtual ~level() {}
+    };
+
+    template <int I>
+    struct level: level<I - 1> {
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(level<I - 1>)
+    };
+
+    struct leaf final: level<8> {
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(level<8>)
+    };
+
+    struct other_leaf final: level<8> {
+        BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(level<8>)
+    };
+}
+
+using namespace some_long_namespace_name;
+
+template <class Caster>
+double measure(level<0>* const* objects, Caster caster) {
+    const std::size_t iterations = 1000000;
+    std::size_t found = 0;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        found += (caster(objects[i & 1]) != nullptr);
+    }
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    // Every second object is of the requested type
+    BOOST_TEST_EQ(found, iterations / 2);
+    return std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+}
+
+struct final_runtime_cast {
+    leaf* operator()(level<0>* p) const noexcept { return boost::typeindex::runtime_cast<leaf*>(p); }
+};
+
+struct exact_cast {
+    leaf* operator()(level<0>* p) const noexcept { return boost::typeindex::exact_runtime_cast<leaf*>(p); }
+};
+
+struct non_final_runtime_cast {
+    level<8>* operator()(level<0>* p) const noexcept { return boost::typeindex::runtime_cast<level<8>*>(p); }
+};
+
+#if !defined(BOOST_NO_RTTI)
+struct final_dynamic_cast {
+    leaf* operator()(level<0>* p) const noexcept { return dynamic_cast<leaf*>(p); }
+};
+
+struct non_final_dynamic_cast {
+    level<8>* operator()(level<0>* p) const noexcept { return dynamic_cast<level<8>*>(p); }
+};
+#endif
+
+typedef std::vector<level<0>*> objects_t;
+typedef std::vector<level<8>*> results_t;
+
+template <class Filter>
+double measure_range(const objects_t& objects, results_t& results, Filter filter) {
+    const std::size_t iterations = 100;
+    const std::size_t expected = results.size();
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        results.clear();
+        filter(objects, results);
+    }
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    BOOST_TEST_EQ(results.size(), expected);
+    return std::chrono::duration<double, std::nano>(finish - start).count() / iterations / objects.size();
+}
+
+struct range_filter_cast {
+    void operator()(const objects_t& objects, results_t& results) const {
+        boost::typeindex::runtime_filter_cast<level<8>*>(objects.begin(), objects.end(), std::back_inserter(results));
+    }
+};
+
+struct range_runtime_cast {
+    void operator()(const objects_t& objects, results_t& results) const {
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            if (level<8>* p = boost::typeindex::runtime_cast<level<8>*>(objects[i])) {
+                results.push_back(p);
+            }
+        }
+    }
+};
+
+#if !defined(BOOST_NO_RTTI)
+struct range_dynamic_cast {
+    void operator()(const objects_t& objects, results_t& results) const {
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            if (level<8>* p = dynamic_cast<level<8>*>(objects[i])) {
+                results.push_back(p);
+            }
+        }
+    }
+};
+#endif
+
+void range_benchmark() {
+    leaf l;
+    other_leaf o;
+    level<8> l8;
+    level<7> l7;
+    level<3> l3;
+
+    objects_t objects;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        level<0>* const mixed[] = {&l, &l7, &o, &l8, &l3};
+        objects.push_back(mixed[(i * 7) % 5]);
+    }
+
+    results_t results;
+    range_runtime_cast()(objects, results);
+    results_t filtered;
+    range_filter_cast()(objects, filtered);
+    BOOST_TEST(results == filtered);
+
+    std::cout << "Casts of " << objects.size() << " objects of 5 classes:\n"
+        << "  runtime_filter_cast:         " << measure_range(objects, filtered, range_filter_cast()) << "ns per object\n"
+        << "  runtime_cast in a loop:      " << measure_range(objects, results, range_runtime_cast()) << "ns per object\n"
+#if !defined(BOOST_NO_RTTI)
+        << "  dynamic_cast in a loop:      " << measure_range(objects, results, range_dynamic_cast()) << "ns per object\n"
+#endif
+        ;
+}
+
+int main() {
+    leaf l;
+    other_leaf o;
+    level<8> l8;
+    level<7> l7;
+    level<0>* volatile leaves[2] = {&l, &o};
+    level<0>* volatile levels[2] = {&l8, &l7};
+    level<0>* const objects[2] = {leaves[0], leaves[1]};
+    level<0>* const non_final_objects[2] = {levels[0], levels[1]};
+
+    BOOST_TEST(boost::typeindex::detail::is_final_class<leaf>::value);
+    BOOST_TEST_EQ(boost::typeindex::runtime_cast<leaf*>(objects[0]), &l);
+    BOOST_TEST_EQ(boost::typeindex::runtime_cast<leaf*>(objects[1]), (leaf*)NULL);
+    BOOST_TEST_EQ(boost::typeindex::exact_runtime_cast<level<8>*>(objects[0]), (level<8>*)NULL);
+    BOOST_TEST_EQ(boost::typeindex::exact_runtime_cast<level<8>*>(non_final_objects[0]), &l8);
+
+    std::cout << "Casts from the base of a 10 levels deep hierarchy:\n"
+        << "  runtime_cast to final class: " << measure(objects, final_runtime_cast()) << "ns\n"
+        << "  exact_runtime_cast:          " << measure(objects, exact_cast()) << "ns\n"
+        << "  runtime_cast to non final:   " << measure(non_final_objects, non_final_runtime_cast()) << "ns\n"
+#if !defined(BOOST_NO_RTTI)
+        << "  dynamic_cast to final class: " << measure(objects, final_dynamic_cast()) << "ns\n"
+        << "  dynamic_cast to non final:   " << measure(non_final_objects, non_final_dynamic_cast()) << "ns\n"
+#endif
+        ;
+
+    range_benchmark();
+
+    return boost::report_errors();
+}
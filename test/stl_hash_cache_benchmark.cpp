@@ -0,0 +1,135 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * tests BOOST_TYPE_INDEX_STL_CACHE_HASH macro
+// * outputs the time of std::type_info::hash_code() and cached stl_type_index::hash_code() calls for long type names
+
+#define BOOST_TYPE_INDEX_STL_CACHE_HASH
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_RTTI)
+
+#include <boost/type_index/stl_type_index.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace some_long_namespace_name {
+    template <class T, int I>
+    struct some_long_template_name {};
+}
+
+template <int Depth, int I>
+struct long_name {
+    typedef some_long_namespace_name::some_long_template_name<
+        typename long_name<Depth - 1, I>::type, Depth
+    > type;
+};
+
+template <int I>
+struct long_name<0, I> {
+    typedef some_long_namespace_name::some_long_template_name<int, I> type;
+};
+
+typedef boost::typeindex::stl_type_index stl_type_index;
+
+template <int Depth>
+std::vector<stl_type_index> make_types() {
+    std::vector<stl_type_index> types;
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 0>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 1>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 2>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 3>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 4>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 5>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 6>::type>());
+    types.push_back(stl_type_index::type_id<typename long_name<Depth, 7>::type>());
+    return types;
+}
+
+void hashes_match(const std::vector<stl_type_index>& types) {
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        BOOST_TEST_EQ(types[i].hash_code(), types[i].type_info().hash_code());
+        BOOST_TEST_EQ(types[i].hash_code(), types[i].hash_code());
+    }
+}
+
+void hashes_match_concurrently(const std::vector<stl_type_index>& types) {
+    std::vector<std::size_t> results[4];
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([&types, &results, i]() {
+            for (std::size_t j = 0; j < types.size(); ++j) {
+                results[i].push_back(types[j].hash_code());
+            }
+        });
+    }
+    for (std::size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        BOOST_TEST_EQ(results[i].size(), types.size());
+        for (std::size_t j = 0; j < results[i].size(); ++j) {
+            BOOST_TEST_EQ(results[i][j], types[j].type_info().hash_code());
+        }
+    }
+}
+
+template <class Hasher>
+double measure(const std::vector<stl_type_index>& types, Hasher hasher) {
+    const std::size_t iterations = 100000;
+    std::size_t result = 0;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        result += hasher(types[i % types.size()]);
+    }
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    BOOST_TEST(result != 0);
+    return std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+}
+
+struct type_info_hasher {
+    std::size_t operator()(const stl_type_index& t) const noexcept { return t.type_info().hash_code(); }
+};
+
+struct cached_hasher {
+    std::size_t operator()(const stl_type_index& t) const noexcept { return t.hash_code(); }
+};
+
+template <int Depth>
+void benchmark() {
+    const std::vector<stl_type_index> types = make_types<Depth>();
+    hashes_match(types);
+    hashes_match_concurrently(types);
+
+    std::cout << "Mangled name length " << std::strlen(types[0].raw_name()) << ": "
+        << "std::type_info::hash_code() " << measure(types, type_info_hasher()) << "ns, "
+        << "cached hash_code() " << measure(types, cached_hasher()) << "ns\n";
+}
+
+int main() {
+    benchmark<0>();
+    benchmark<8>();
+    benchmark<32>();
+    benchmark<128>();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main() {}
+
+#endif
@@ -0,0 +1,114 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This cpp file:
+// * tests that the cached stl_type_index::pretty_name() is the same for all the threads
+// * outputs the time of demangling and of the cached stl_type_index::pretty_name() calls
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_RTTI)
+
+#include <boost/type_index/stl_type_index.hpp>
+#include <boost/core/demangle.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace some_namespace {
+    template <class T, int I>
+    struct some_template {};
+}
+
+typedef boost::typeindex::stl_type_index stl_type_index;
+
+std::vector<stl_type_index> make_types() {
+    std::vector<stl_type_index> types;
+    types.push_back(stl_type_index::type_id<int>());
+    types.push_back(stl_type_index::type_id<std::string>());
+    types.push_back(stl_type_index::type_id_with_cvr<const std::string&>());
+    types.push_back(stl_type_index::type_id<std::map<std::string, std::vector<int> > >());
+    types.push_back(stl_type_index::type_id<some_namespace::some_template<std::map<int, std::string>, 1> >());
+    types.push_back(stl_type_index::type_id_with_cvr<volatile some_namespace::some_template<int, 2>&&>());
+    return types;
+}
+
+void names_match_concurrently(const std::vector<stl_type_index>& types) {
+    std::vector<std::string> results[4];
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([&types, &results, i]() {
+            for (std::size_t j = 0; j < types.size(); ++j) {
+                results[i].push_back(types[j].pretty_name());
+            }
+        });
+    }
+    for (std::size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        BOOST_TEST_EQ(results[i].size(), types.size());
+        for (std::size_t j = 0; j < results[i].size(); ++j) {
+            BOOST_TEST_EQ(results[i][j], types[j].pretty_name());
+        }
+    }
+
+    BOOST_TEST_EQ(types[0].pretty_name(), "int");
+    BOOST_TEST_EQ(types[1].pretty_name(), types[2].pretty_name().substr(0, types[1].pretty_name().size()));
+    BOOST_TEST(types[2].pretty_name().find("cvr_saver") == std::string::npos);
+    BOOST_TEST(types[5].pretty_name().find("cvr_saver") == std::string::npos);
+    BOOST_TEST(types[5].pretty_name().find("volatile") != std::string::npos);
+}
+
+template <class Namer>
+double measure(const std::vector<stl_type_index>& types, Namer namer) {
+    const std::size_t iterations = 100000;
+    std::size_t result = 0;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        result += namer(types[i % types.size()]);
+    }
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    BOOST_TEST(result != 0);
+    return std::chrono::duration<double, std::nano>(finish - start).count() / iterations;
+}
+
+struct demangle_namer {
+    std::size_t operator()(const stl_type_index& t) const {
+        return boost::core::demangle(t.type_info().name()).size();
+    }
+};
+
+struct cached_namer {
+    std::size_t operator()(const stl_type_index& t) const {
+        return t.pretty_name().size();
+    }
+};
+
+int main() {
+    const std::vector<stl_type_index> types = make_types();
+    names_match_concurrently(types);
+
+    std::cout << "boost::core::demangle() " << measure(types, demangle_namer()) << "ns, "
+        << "cached pretty_name() " << measure(types, cached_namer()) << "ns\n";
+
+    return boost::report_errors();
+}
+
+#else
+
+int main() {}
+
+#endif
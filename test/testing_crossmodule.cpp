@@ -41,6 +41,10 @@ void comparing_types_between_modules()
     BOOST_TEST_NE(t_int, test_lib::get_user_defined_class());
     BOOST_TEST_NE(t_const_int, test_lib::get_const_user_defined_class());
 
+    BOOST_TEST_EQ(t_int.fingerprint(), test_lib::get_integer().fingerprint());
+    BOOST_TEST_EQ(t_userdef.fingerprint(), test_lib::get_user_defined_class().fingerprint());
+    BOOST_TEST_NE(t_const_int.fingerprint(), test_lib::get_integer().fingerprint());
+
     // MSVC supports detect_missmatch pragma, but /GR- silently switch disable the link time check.
     // /GR- undefies the _CPPRTTI macro. Using it to detect working detect_missmatch pragma.
     #if !defined(BOOST_HAS_PRAGMA_DETECT_MISMATCH) || !defined(_CPPRTTI)
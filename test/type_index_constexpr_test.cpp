@@ -49,6 +49,22 @@ void strcmp_same() {
     );
 }
 
+void name_compare_same() {
+    using boost::typeindex::detail::constexpr_name_compare;
+
+    const std::size_t hello1_size = sizeof("Hello word") - 1;
+    const std::size_t hello2_size = sizeof("Hello word, pal!") - 1;
+
+    BOOST_TEST_EQ(constexpr_name_compare(hello1, hello1_size, hello1, hello1_size), 0);
+    BOOST_TEST_EQ(constexpr_name_compare(hello1, hello1_size, hello2, hello1_size), 0);
+    BOOST_TEST(constexpr_name_compare(hello1, hello1_size, hello2, hello2_size) < 0);
+    BOOST_TEST(constexpr_name_compare(hello2, hello2_size, hello1, hello1_size) > 0);
+    BOOST_TEST(constexpr_name_compare(hello1, 0, hello2, 0) == 0);
+
+    BOOST_CXX14_CONSTEXPR int compile_time = constexpr_name_compare("int", 3, "short", 5);
+    BOOST_TEST_EQ(compile_time < 0, std::strcmp("int", "short") < 0);
+}
+
 void search_same() {
     using boost::typeindex::detail::constexpr_search;
     BOOST_TEST(
@@ -70,6 +86,25 @@ void search_same() {
     );
 }
 
+void hash_same() {
+    using boost::typeindex::detail::constexpr_name_hash;
+    using boost::typeindex::detail::name_hash;
+
+    const std::size_t hello2_size = sizeof("Hello word, pal!") - 1;
+    for (std::size_t i = 0; i <= hello2_size; ++i) {
+        BOOST_TEST_EQ(constexpr_name_hash(hello2, i), name_hash(hello2, i));
+        BOOST_TEST_EQ(constexpr_name_hash(hello2 + hello2_size - i, i), name_hash(hello2 + hello2_size - i, i));
+    }
+
+    BOOST_TEST_EQ(name_hash(hello1), name_hash(hello1, sizeof("Hello word") - 1));
+    BOOST_TEST_NE(name_hash(hello1), name_hash(hello2));
+    BOOST_TEST_NE(name_hash(hello2, 8), name_hash(hello2, 9));
+
+    // Hash does not depend on the platform
+    BOOST_TEST_EQ(name_hash(""), 0x9ca066f1a4ab2eeaULL);
+    BOOST_TEST_EQ(name_hash("int"), 0x282bc9fb94ab7fddULL);
+}
+
 template <class T, std::size_t N>
 BOOST_CXX14_CONSTEXPR bool in_namespace(const char (&ns)[N]) BOOST_NOEXCEPT {
     BOOST_CXX14_CONSTEXPR const char* name = boost::typeindex::ctti_type_index::type_id<T>().raw_name();
@@ -144,13 +179,48 @@ void constexpr_test() {
     BOOST_CXX14_CONSTEXPR bool not_in_namespace = !is_boost_namespace<std::string>();
     BOOST_TEST(not_in_namespace);
 
+    BOOST_CXX14_CONSTEXPR std::size_t int_hash = t_int0.hash_code();
+    BOOST_TEST_EQ(int_hash, t_int1.hash_code());
+    BOOST_TEST_EQ(int_hash, ctti_type_index::type_id_with_cvr<int>().hash_code());
+
+    BOOST_CXX14_CONSTEXPR bool hashes_differ = (t_int0.hash_code() != t_short0.hash_code());
+    BOOST_TEST(hashes_differ);
+
+    BOOST_CXX14_CONSTEXPR std::size_t int_size = boost::detail::ctti<int>::size();
+    BOOST_TEST_EQ(int_size, t_int0.pretty_name().size());
+    BOOST_TEST_EQ(t_int0.pretty_name(), "int");
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t int_name_hash = detail::constexpr_name_hash("int", 3);
+    BOOST_TEST_EQ(int_hash, static_cast<std::size_t>(int_name_hash));
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t int_fingerprint = t_int0.fingerprint();
+    BOOST_TEST_EQ(int_fingerprint, int_name_hash);
+    BOOST_TEST_EQ(int_fingerprint, 0x282bc9fb94ab7fddULL);
+
+#if defined(BOOST_TYPE_INDEX_DETAIL_CTTI_TRIMMED_NAMES)
+    // Names contain only the type name and are zero terminated
+    constexpr const char* int_raw_name = t_int0.raw_name();
+    static_assert(int_raw_name[0] == 'i' && int_raw_name[1] == 'n' && int_raw_name[2] == 't' && int_raw_name[3] == '\0', "");
+    static_assert(detail::constexpr_strcmp_loop(t_short0.name(), "short") == 0 || detail::constexpr_strcmp_loop(t_short0.name(), "short int") == 0, "");
+    BOOST_TEST_EQ(std::string(t_int0.name()), t_int0.pretty_name());
+#endif
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    constexpr std::string_view int_view = t_int0.pretty_name_view();
+    static_assert(int_view.size() == boost::detail::ctti<int>::size(), "");
+    BOOST_TEST_EQ(int_view, "int");
+    BOOST_TEST_EQ(t_int0.raw_name_view(), t_int0.raw_name());
+#endif
+
 #endif // #if !defined(_MSC_VER) || _MSC_VER > 1916
 }
 
 
 int main() {
     strcmp_same();
+    name_compare_same();
     search_same();
+    hash_same();
     constexpr_test();
     return boost::report_errors();
 }
@@ -0,0 +1,178 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/type_index_hash.hpp>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace my_namespace {
+    class my_class{};
+
+    struct names_info {
+        const char* raw;
+        const char* pretty;
+    };
+
+    // Redefines pretty_name() and does not redefine pretty_name_view()
+    class names_index: public boost::typeindex::type_index_facade<names_index, names_info> {
+        const names_info* data_;
+
+    public:
+        typedef names_info type_info_t;
+
+        explicit names_index(const type_info_t& data) noexcept
+            : data_(&data)
+        {}
+
+        const type_info_t& type_info() const noexcept { return *data_; }
+        const char* raw_name() const noexcept { return data_->raw; }
+        std::string pretty_name() const { return data_->pretty; }
+    };
+}
+
+using boost::typeindex::type_index;
+using boost::typeindex::type_index_hash;
+using boost::typeindex::type_index_equal;
+using boost::typeindex::type_index_fast_less;
+using boost::typeindex::type_id;
+
+template <class T>
+void hash_same_for_all_keys() {
+    const type_index_hash hasher;
+    const type_index t = type_id<T>();
+    const std::string name = t.pretty_name();
+
+    BOOST_TEST_EQ(hasher(t), static_cast<std::size_t>(t.fingerprint()));
+    BOOST_TEST_EQ(hasher(t), hasher(t.type_info()));
+    BOOST_TEST_EQ(hasher(t), hasher(name));
+    BOOST_TEST_EQ(hasher(t), hasher(name.c_str()));
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    BOOST_TEST_EQ(hasher(t), hasher(std::string_view(name)));
+#endif
+}
+
+template <class T, class U>
+void equal_for_all_keys() {
+    const type_index_equal eq;
+    const type_index t = type_id<T>();
+    const type_index u = type_id<U>();
+    const std::string name = t.pretty_name();
+
+    BOOST_TEST(eq(t, t));
+    BOOST_TEST(eq(t, t.type_info()));
+    BOOST_TEST(eq(t.type_info(), t));
+    BOOST_TEST(eq(t, name));
+    BOOST_TEST(eq(name, t));
+    BOOST_TEST(eq(t, name.c_str()));
+    BOOST_TEST(eq(name.c_str(), t));
+
+    BOOST_TEST(!eq(u, t));
+    BOOST_TEST(!eq(u, t.type_info()));
+    BOOST_TEST(!eq(t.type_info(), u));
+    BOOST_TEST(!eq(u, name));
+    BOOST_TEST(!eq(name, u));
+    BOOST_TEST(!eq(u, name.c_str()));
+    BOOST_TEST(!eq(t, name.substr(0, name.size() - 1)));
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    BOOST_TEST(eq(t, std::string_view(name)));
+    BOOST_TEST(eq(std::string_view(name), t));
+    BOOST_TEST(!eq(u, std::string_view(name)));
+#endif
+}
+
+void heterogeneous_lookup() {
+    std::unordered_set<type_index, type_index_hash, type_index_equal> types;
+    types.insert(type_id<int>());
+    types.insert(type_id<my_namespace::my_class>());
+    BOOST_TEST_EQ(types.size(), 2u);
+
+    BOOST_TEST(types.find(type_id<int>()) != types.end());
+    BOOST_TEST(types.find(type_id<double>()) == types.end());
+
+#if defined(__cpp_lib_generic_unordered_lookup) && __cpp_lib_generic_unordered_lookup >= 201811L
+    const std::string name = type_id<my_namespace::my_class>().pretty_name();
+    BOOST_TEST(types.find(type_id<int>().type_info()) != types.end());
+    BOOST_TEST(types.find(name) != types.end());
+    BOOST_TEST(types.find(std::string_view(name)) != types.end());
+    BOOST_TEST(types.find("int") != types.end());
+    BOOST_TEST(types.find("double") == types.end());
+    BOOST_TEST(types.find(type_id<double>().type_info()) == types.end());
+#endif
+}
+
+void redefined_pretty_name() {
+    const my_namespace::names_info info = {"i", "int"};
+    const my_namespace::names_index index(info);
+    const boost::typeindex::basic_type_index_hash<my_namespace::names_index> hasher;
+    const boost::typeindex::basic_type_index_equal<my_namespace::names_index> eq;
+
+    BOOST_TEST_EQ(hasher(index), hasher("int"));
+    BOOST_TEST(eq(index, "int"));
+    BOOST_TEST(eq(std::string("int"), index));
+    BOOST_TEST(!eq(index, "i"));
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    BOOST_TEST(eq(index, std::string_view("int")));
+    BOOST_TEST(!boost::typeindex::detail::has_pretty_name_view<my_namespace::names_index>::value);
+    BOOST_TEST(boost::typeindex::detail::has_pretty_name_view<type_index>::value);
+#endif
+}
+
+void fast_ordering() {
+    const type_index_fast_less less;
+    std::vector<type_index> types;
+    types.push_back(type_id<int>());
+    types.push_back(type_id<short>());
+    types.push_back(type_id<std::string>());
+    types.push_back(type_id<my_namespace::my_class>());
+    types.push_back(type_id<std::vector<int> >());
+    types.push_back(type_id<std::vector<short> >());
+    std::sort(types.begin(), types.end(), less);
+
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        BOOST_TEST(!less(types[i], types[i]));
+        BOOST_TEST(!less(types[i], types[i].type_info()));
+        for (std::size_t j = i + 1; j < types.size(); ++j) {
+            BOOST_TEST(less(types[i], types[j]));
+            BOOST_TEST(!less(types[j], types[i]));
+            BOOST_TEST(less(types[i].type_info(), types[j]));
+            BOOST_TEST(types[i].fingerprint() <= types[j].fingerprint());
+        }
+
+        const std::vector<type_index>::const_iterator it = std::lower_bound(types.begin(), types.end(), types[i], less);
+        BOOST_TEST(it != types.end() && *it == types[i]);
+    }
+
+    BOOST_TEST(!std::binary_search(types.begin(), types.end(), type_id<double>(), less));
+
+#if defined(__cpp_lib_generic_associative_lookup) && __cpp_lib_generic_associative_lookup >= 201304L
+    std::set<type_index, type_index_fast_less> set(types.begin(), types.end());
+    BOOST_TEST(set.find(type_id<int>().type_info()) != set.end());
+    BOOST_TEST(set.find(type_id<double>().type_info()) == set.end());
+#endif
+}
+
+int main() {
+    hash_same_for_all_keys<int>();
+    hash_same_for_all_keys<my_namespace::my_class>();
+    hash_same_for_all_keys<std::string>();
+
+    equal_for_all_keys<int, short>();
+    equal_for_all_keys<my_namespace::my_class, int>();
+    equal_for_all_keys<std::string, my_namespace::my_class>();
+
+    heterogeneous_lookup();
+    redefined_pretty_name();
+    fast_ordering();
+
+    return boost::report_errors();
+}
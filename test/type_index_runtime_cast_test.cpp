@@ -10,10 +10,19 @@
 
 #include <boost/type_index/runtime_cast.hpp>
 #include <boost/type_index/runtime_cast/boost_shared_ptr_cast.hpp>
+#include <boost/type_index/runtime_cast/boost_intrusive_ptr_cast.hpp>
+#include <boost/type_index/runtime_cast/std_unique_ptr_cast.hpp>
 #include <boost/smart_ptr/make_shared.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <boost/smart_ptr/intrusive_ref_counter.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #if !defined(BOOST_NO_CXX11_SMART_PTR)
 #  include <boost/type_index/runtime_cast/std_shared_ptr_cast.hpp>
 #endif
@@ -97,6 +106,52 @@ struct level2 : level1_a, level1_b {
     IMPLEMENT_CLASS(level2)
 };
 
+struct side_base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    IMPLEMENT_CLASS(side_base)
+};
+
+struct side_and_virtual : side_base, baseV1 {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(side_base, baseV1)
+    IMPLEMENT_CLASS(side_and_virtual)
+};
+
+// Does not implement the runtime cast, but places the virtual base at another offset from side_and_virtual
+struct padded_side_and_virtual : unrelated, side_and_virtual {
+    IMPLEMENT_CLASS(padded_side_and_virtual)
+};
+
+struct final_derived final : single_derived {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(single_derived)
+    IMPLEMENT_CLASS(final_derived)
+};
+
+struct final_virtual_derived final : baseV1 {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(baseV1)
+    IMPLEMENT_CLASS(final_virtual_derived)
+};
+
+// Unregistered most derived class, final overriders differ for the level1_a and level1_b subobjects
+struct unregistered_level2 : level1_a, level1_b {
+    IMPLEMENT_CLASS(unregistered_level2)
+};
+
+struct counted_base : boost::intrusive_ref_counter<counted_base> {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST()
+    IMPLEMENT_CLASS(counted_base)
+    virtual ~counted_base() {}
+};
+
+struct counted_derived : counted_base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(counted_base)
+    IMPLEMENT_CLASS(counted_derived)
+};
+
+struct counted_other : counted_base {
+    BOOST_TYPE_INDEX_IMPLEMENT_RUNTIME_CAST(counted_base)
+    IMPLEMENT_CLASS(counted_other)
+};
+
 struct reg_base {
     BOOST_TYPE_INDEX_REGISTER_RUNTIME_CLASS()
 };
@@ -247,6 +302,164 @@ void diamond_non_virtual()
     BOOST_TEST_EQ(l1_b->name, "level1_b");
 }
 
+void cached_results()
+{
+    using namespace boost::typeindex;
+    for (int i = 0; i < 3; ++i) {
+        multiple_derived d;
+        base1* b1 = &d;
+        BOOST_TEST_EQ(runtime_pointer_cast<base2>(b1), static_cast<base2*>(&d));
+        BOOST_TEST_EQ(runtime_pointer_cast<multiple_derived>(b1), &d);
+        BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(b1), (unrelated*)NULL);
+
+        // Offsets of the virtual bases differ in objects with the same final overrider
+        side_and_virtual sv;
+        padded_side_and_virtual psv;
+        side_base* s1 = &sv;
+        side_base* s2 = &psv;
+        BOOST_TEST_EQ(runtime_pointer_cast<base>(s1), static_cast<base*>(&sv));
+        BOOST_TEST_EQ(runtime_pointer_cast<base>(s2), static_cast<base*>(&psv));
+        BOOST_TEST_EQ(runtime_pointer_cast<base>(s2)->name, "base");
+        BOOST_TEST_EQ(runtime_pointer_cast<baseV1>(s2), static_cast<baseV1*>(&psv));
+        BOOST_TEST_EQ(runtime_pointer_cast<unrelated>(s2), (unrelated*)NULL);
+    }
+}
+
+void final_class()
+{
+    using namespace boost::typeindex;
+    BOOST_TEST(detail::is_final_class<final_derived>::value);
+    BOOST_TEST(detail::is_final_class<final_virtual_derived>::value);
+    BOOST_TEST(!detail::is_final_class<single_derived>::value);
+
+    final_derived f;
+    base* b = &f;
+    BOOST_TEST_EQ(runtime_pointer_cast<final_derived>(b), &f);
+    BOOST_TEST_EQ(runtime_cast<final_derived&>(*b).name, "final_derived");
+    BOOST_TEST_EQ(runtime_pointer_cast<single_derived>(b), static_cast<single_derived*>(&f));
+
+    single_derived d;
+    BOOST_TEST_EQ(runtime_pointer_cast<final_derived>(static_cast<base*>(&d)), (final_derived*)NULL);
+    BOOST_TEST_EQ(runtime_pointer_cast<final_virtual_derived>(b), (final_virtual_derived*)NULL);
+
+    // Final class with a virtual base can not be reached with static_cast
+    final_virtual_derived fv;
+    base* bv = &fv;
+    BOOST_TEST_EQ(runtime_pointer_cast<final_virtual_derived>(bv), &fv);
+    BOOST_TEST_EQ(runtime_pointer_cast<final_virtual_derived>(bv)->name, "final_virtual_derived");
+    BOOST_TEST_EQ(runtime_pointer_cast<final_derived>(bv), (final_derived*)NULL);
+}
+
+void exact_cast()
+{
+    using namespace boost::typeindex;
+    single_derived d;
+    base* b = &d;
+    BOOST_TEST_EQ(exact_runtime_cast<single_derived*>(b), &d);
+    BOOST_TEST_EQ(exact_runtime_cast<single_derived const*>(static_cast<base const*>(b)), &d);
+    BOOST_TEST_EQ(exact_runtime_cast<base*>(b), (base*)NULL);
+    BOOST_TEST_EQ(exact_runtime_cast<unrelated*>(b), (unrelated*)NULL);
+    BOOST_TEST_EQ(exact_runtime_cast<single_derived&>(*b).name, "single_derived");
+
+    // Instance of a class derived from single_derived is not an exact match
+    final_derived f;
+    base* bf = &f;
+    BOOST_TEST_EQ(exact_runtime_cast<single_derived*>(bf), (single_derived*)NULL);
+    BOOST_TEST_EQ(exact_runtime_cast<final_derived*>(bf), &f);
+    BOOST_TEST_THROWS(exact_runtime_cast<single_derived const&>(*static_cast<base const*>(bf)), bad_runtime_cast);
+
+    multiple_virtual_derived mv;
+    base* bmv = &mv;
+    BOOST_TEST_EQ(exact_runtime_cast<multiple_virtual_derived*>(bmv), &mv);
+    BOOST_TEST_EQ(exact_runtime_cast<multiple_virtual_derived*>(bmv)->name, "multiple_virtual_derived");
+    BOOST_TEST_EQ(exact_runtime_cast<baseV1*>(bmv), (baseV1*)NULL);
+
+    // Most derived class that implements the runtime_cast is the exact match
+    padded_side_and_virtual psv;
+    side_base* s = &psv;
+    BOOST_TEST_EQ(exact_runtime_cast<side_and_virtual*>(s), static_cast<side_and_virtual*>(&psv));
+}
+
+void filter_cast()
+{
+    using namespace boost::typeindex;
+    base b;
+    single_derived d1, d2;
+    final_derived f;
+    unrelated_with_base u;
+    base* objects[] = {&d1, &b, NULL, &f, &u, &d2, &f, &b};
+    const std::size_t size = sizeof(objects) / sizeof(objects[0]);
+
+    std::vector<single_derived*> derived;
+    runtime_filter_cast<single_derived*>(objects, objects + size, std::back_inserter(derived));
+    BOOST_TEST_EQ(derived.size(), 4u);
+    for (std::size_t i = 0, j = 0; i < size; ++i) {
+        if (objects[i] && runtime_cast<single_derived*>(objects[i])) {
+            BOOST_TEST_EQ(derived[j++], runtime_cast<single_derived*>(objects[i]));
+        }
+    }
+
+    base const* const_objects[] = {&f, &b, &f};
+    single_derived const* out[3] = {};
+    single_derived const** end = runtime_filter_cast<single_derived const*>(const_objects, const_objects + 3, out);
+    BOOST_TEST_EQ(end - out, 2);
+    BOOST_TEST_EQ(out[0], static_cast<single_derived const*>(&f));
+    BOOST_TEST_EQ(out[1]->name, "single_derived");
+
+    // Offsets of the virtual bases are not reused for the objects of the same class
+    side_and_virtual sv;
+    padded_side_and_virtual psv1, psv2;
+    side_base* sides[] = {&psv1, &sv, &psv2, &psv1};
+    base* bases[4] = {};
+    BOOST_TEST_EQ(runtime_filter_cast<base*>(sides, sides + 4, bases) - bases, 4);
+    BOOST_TEST_EQ(bases[0], static_cast<base*>(&psv1));
+    BOOST_TEST_EQ(bases[1], static_cast<base*>(&sv));
+    BOOST_TEST_EQ(bases[2], static_cast<base*>(&psv2));
+    BOOST_TEST_EQ(bases[2]->name, "base");
+
+    // Result depends on the subobject, not only on the most derived class
+    unregistered_level2 ul1, ul2;
+    base* diamond[] = {static_cast<level1_a*>(&ul1), static_cast<level1_b*>(&ul2)};
+    level1_a* diamond_out[2] = {};
+    BOOST_TEST_EQ(runtime_filter_cast<level1_a*>(diamond, diamond + 2, diamond_out) - diamond_out, 1);
+    BOOST_TEST_EQ(diamond_out[0], static_cast<level1_a*>(&ul1));
+    BOOST_TEST_EQ(runtime_pointer_cast<level1_a>(diamond[1]), (level1_a*)NULL);
+    std::swap(diamond[0], diamond[1]);
+    BOOST_TEST_EQ(runtime_filter_cast<level1_a*>(diamond, diamond + 2, diamond_out) - diamond_out, 1);
+    BOOST_TEST_EQ(diamond_out[0], static_cast<level1_a*>(&ul1));
+
+    // Casts to the base just skip the nulls
+    single_derived* derived_objects[] = {&d1, NULL, &d2};
+    base* upcasted[3] = {};
+    BOOST_TEST_EQ(runtime_filter_cast<base*>(derived_objects, derived_objects + 3, upcasted) - upcasted, 2);
+    BOOST_TEST_EQ(upcasted[1], static_cast<base*>(&d2));
+}
+
+void base_table()
+{
+#if defined(BOOST_TYPE_INDEX_DETAIL_RUNTIME_CAST_BASE_TABLE)
+    using boost::typeindex::detail::runtime_class_table;
+    const void* self = NULL;
+
+    // level2, level1_a, base, level1_b, base
+    level2 l2;
+    const runtime_class_table& t1 = *l2.boost_type_index_table_(self);
+    BOOST_TEST_EQ(self, static_cast<const void*>(&l2));
+    BOOST_TEST_EQ(t1.size, 5u);
+    BOOST_TEST(t1.casts[0] && t1.casts[1] && t1.casts[3]);
+    BOOST_TEST(!t1.casts[2] && !t1.casts[4]); // ambiguous base
+    BOOST_TEST_EQ(t1.casts[3](self), static_cast<const void*>(static_cast<level1_b*>(&l2)));
+
+    // side_and_virtual, side_base, baseV1, base
+    side_and_virtual sv;
+    const runtime_class_table& t2 = *sv.boost_type_index_table_(self);
+    BOOST_TEST_EQ(t2.size, 4u);
+    BOOST_TEST(t2.casts[0] && t2.casts[1] && t2.casts[2]);
+    BOOST_TEST(!t2.casts[3]); // virtual base
+    BOOST_TEST_EQ(t2.fingerprints[2], boost::typeindex::ctti_type_index::type_id<baseV1>().fingerprint());
+#endif
+}
+
 void boost_shared_ptr()
 {
     using namespace boost::typeindex;
@@ -255,6 +468,16 @@ void boost_shared_ptr()
     boost::shared_ptr<single_derived> d2 = runtime_pointer_cast<single_derived>(b);
     BOOST_TEST_NE(d2, boost::shared_ptr<single_derived>());
     BOOST_TEST_EQ(d2->name, "single_derived");
+
+    // Source is left intact on failure
+    BOOST_TEST(!runtime_pointer_cast<unrelated>(std::move(b)));
+    BOOST_TEST_EQ(b, d);
+
+    // Ownership is moved on success
+    boost::shared_ptr<single_derived> d3 = runtime_pointer_cast<single_derived>(std::move(b));
+    BOOST_TEST(!b);
+    BOOST_TEST_EQ(d3, d);
+    BOOST_TEST_EQ(d3.use_count(), 3);
 }
 
 void std_shared_ptr()
@@ -266,9 +489,62 @@ void std_shared_ptr()
     std::shared_ptr<single_derived> d2 = runtime_pointer_cast<single_derived>(b);
     BOOST_TEST_NE(d2, std::shared_ptr<single_derived>());
     BOOST_TEST_EQ(d2->name, "single_derived");
+
+    // Source is left intact on failure
+    BOOST_TEST(!runtime_pointer_cast<unrelated>(std::move(b)));
+    BOOST_TEST_EQ(b, d);
+
+    // Ownership is moved on success
+    std::shared_ptr<single_derived> d3 = runtime_pointer_cast<single_derived>(std::move(b));
+    BOOST_TEST(!b);
+    BOOST_TEST_EQ(d3, d);
+    BOOST_TEST_EQ(d3.use_count(), 3);
 #endif
 }
 
+void std_unique_ptr()
+{
+    using namespace boost::typeindex;
+    counted_derived* const raw = new counted_derived();
+    std::unique_ptr<counted_base> b(raw);
+
+    // Source is left intact on failure
+    BOOST_TEST(!runtime_pointer_cast<counted_other>(std::move(b)));
+    BOOST_TEST_EQ(b.get(), raw);
+
+    std::unique_ptr<counted_derived> d = runtime_pointer_cast<counted_derived>(std::move(b));
+    BOOST_TEST(!b);
+    BOOST_TEST_EQ(d.get(), raw);
+    BOOST_TEST_EQ(d->name, "counted_derived");
+
+    std::unique_ptr<counted_base> b2 = runtime_pointer_cast<counted_base>(std::move(d));
+    BOOST_TEST(!d);
+    BOOST_TEST_EQ(b2.get(), static_cast<counted_base*>(raw));
+}
+
+void boost_intrusive_ptr()
+{
+    using namespace boost::typeindex;
+    boost::intrusive_ptr<counted_base> b(new counted_derived());
+
+    boost::intrusive_ptr<counted_derived> d = runtime_pointer_cast<counted_derived>(b);
+    BOOST_TEST_EQ(d.get(), b.get());
+    BOOST_TEST_EQ(d->name, "counted_derived");
+    BOOST_TEST_EQ(b->use_count(), 2u);
+    BOOST_TEST(!runtime_pointer_cast<counted_other>(b));
+    BOOST_TEST_EQ(b->use_count(), 2u);
+
+    // Source is left intact on failure
+    BOOST_TEST(!runtime_pointer_cast<counted_other>(std::move(b)));
+    BOOST_TEST_EQ(b.get(), d.get());
+
+    // Reference is moved on success
+    boost::intrusive_ptr<counted_derived> d2 = runtime_pointer_cast<counted_derived>(std::move(b));
+    BOOST_TEST(!b);
+    BOOST_TEST_EQ(d2.get(), d.get());
+    BOOST_TEST_EQ(d2->use_count(), 2u);
+}
+
 void register_runtime_class()
 {
     using namespace boost::typeindex;
@@ -289,8 +565,15 @@ int main() {
     const_pointer_interface();
     const_reference_interface();
     diamond_non_virtual();
+    cached_results();
+    final_class();
+    exact_cast();
+    filter_cast();
+    base_table();
     boost_shared_ptr();
     std_shared_ptr();
+    std_unique_ptr();
+    boost_intrusive_ptr();
     register_runtime_class();
     return boost::report_errors();
 }
@@ -90,6 +90,42 @@ void hash_code_type_id()
     BOOST_TEST_LE(t_double1, t_double2);
 }
 
+void name_views_type_id()
+{
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    using namespace boost::typeindex;
+    const type_index t_int = type_id<int>();
+    const type_index t_class = type_id_with_cvr<const my_namespace1::my_class&>();
+
+    BOOST_TEST_EQ(t_int.raw_name_view(), t_int.raw_name());
+    BOOST_TEST_EQ(t_class.raw_name_view(), t_class.raw_name());
+    BOOST_TEST_EQ(t_int.pretty_name_view(), t_int.pretty_name());
+    BOOST_TEST_EQ(t_class.pretty_name_view(), t_class.pretty_name());
+
+    // Views have static storage duration
+    BOOST_TEST(t_int.pretty_name_view().data() == type_id<int>().pretty_name_view().data());
+    BOOST_TEST(t_class.pretty_name_view().data() == t_class.pretty_name_view().data());
+#endif
+}
+
+void fingerprint_type_id()
+{
+    using namespace boost::typeindex;
+    const std::uint64_t t_int = type_id<int>().fingerprint();
+    const std::uint64_t t_class = type_id<my_namespace1::my_class>().fingerprint();
+
+    BOOST_TEST_EQ(t_int, type_id<int>().fingerprint());
+    BOOST_TEST_EQ(t_int, type_id_with_cvr<int>().fingerprint());
+    BOOST_TEST_NE(t_int, type_id<double>().fingerprint());
+    BOOST_TEST_EQ(t_class, type_id<my_namespace1::my_class>().fingerprint());
+    BOOST_TEST_NE(t_class, type_id<my_namespace2::my_class>().fingerprint());
+
+    // Fingerprint is the same in all the processes
+    BOOST_TEST_EQ(t_int, 0x282bc9fb94ab7fddULL);
+    const std::string class_name = type_id<my_namespace1::my_class>().pretty_name();
+    BOOST_TEST_EQ(t_class, detail::name_hash(class_name.data(), class_name.size()));
+}
+
 
 
 template <class T1, class T2>
@@ -383,6 +419,8 @@ int main() {
     copy_construction();
     comparators_type_id();
     hash_code_type_id();
+    fingerprint_type_id();
+    name_views_type_id();
 
     type_id_storing_modifiers();
     type_id_storing_modifiers_vs_nonstoring();
@@ -0,0 +1,106 @@
+//
+// Copyright 2013-2023 Antony Polukhin.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/type_index/type_set.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace my_namespace {
+    class my_class{};
+    template <int I> struct tag{};
+}
+
+using boost::typeindex::ctti_type_index;
+using boost::typeindex::type_set;
+
+typedef type_set<int, my_namespace::my_class, std::string, double, std::vector<int> > small_set;
+
+void small_set_indexes() {
+    BOOST_TEST_EQ(small_set::size(), 5u);
+
+    BOOST_TEST_EQ(small_set::index_of<int>(), 0u);
+    BOOST_TEST_EQ(small_set::index_of<my_namespace::my_class>(), 1u);
+    BOOST_TEST_EQ(small_set::index_of<std::string>(), 2u);
+    BOOST_TEST_EQ(small_set::index_of<double>(), 3u);
+    BOOST_TEST_EQ(small_set::index_of<std::vector<int> >(), 4u);
+    BOOST_TEST_EQ(small_set::index_of<const int&>(), 0u);
+
+    BOOST_TEST_EQ(small_set::index_of(ctti_type_index::type_id<double>()), 3u);
+    BOOST_TEST_EQ(small_set::index_of(ctti_type_index::type_id<double>().fingerprint()), 3u);
+    BOOST_TEST(small_set::contains(ctti_type_index::type_id<std::string>()));
+
+    BOOST_TEST_EQ(small_set::index_of<short>(), small_set::npos);
+    BOOST_TEST_EQ(small_set::index_of<std::vector<short> >(), small_set::npos);
+    BOOST_TEST_EQ(small_set::index_of(ctti_type_index::type_id<void>()), small_set::npos);
+    BOOST_TEST_EQ(small_set::index_of(ctti_type_index::type_id<short>().fingerprint()), small_set::npos);
+    BOOST_TEST_EQ(small_set::index_of(static_cast<std::uint64_t>(0)), small_set::npos);
+    BOOST_TEST(!small_set::contains(ctti_type_index::type_id_with_cvr<const int>()));
+}
+
+void empty_set() {
+    typedef type_set<> empty;
+    BOOST_TEST_EQ(empty::size(), 0u);
+    BOOST_TEST_EQ(empty::index_of<int>(), empty::npos);
+    BOOST_TEST_EQ(empty::index_of<void>(), empty::npos);
+    BOOST_TEST_EQ(empty::index_of(ctti_type_index::type_id<void>().fingerprint()), empty::npos);
+}
+
+template <class Set, int... I>
+void all_indexes_unique() {
+    const std::size_t indexes[] = {Set::template index_of<my_namespace::tag<I> >()...};
+    const std::size_t count = sizeof(indexes) / sizeof(indexes[0]);
+    for (std::size_t i = 0; i < count; ++i) {
+        BOOST_TEST_EQ(indexes[i], i);
+    }
+
+    BOOST_TEST_EQ(Set::template index_of<my_namespace::tag<-1> >(), Set::npos);
+    BOOST_TEST_EQ(Set::template index_of<my_namespace::tag<1000> >(), Set::npos);
+}
+
+#define TAGS_8(I) my_namespace::tag<I>, my_namespace::tag<I + 1>, my_namespace::tag<I + 2>, my_namespace::tag<I + 3>, \
+    my_namespace::tag<I + 4>, my_namespace::tag<I + 5>, my_namespace::tag<I + 6>, my_namespace::tag<I + 7>
+#define INDEXES_8(I) I, I + 1, I + 2, I + 3, I + 4, I + 5, I + 6, I + 7
+
+void big_set_indexes() {
+    typedef type_set<
+        TAGS_8(0), TAGS_8(8), TAGS_8(16), TAGS_8(24), TAGS_8(32), TAGS_8(40), TAGS_8(48), TAGS_8(56)
+    > big_set;
+    BOOST_TEST_EQ(big_set::size(), 64u);
+
+    all_indexes_unique<
+        big_set,
+        INDEXES_8(0), INDEXES_8(8), INDEXES_8(16), INDEXES_8(24), INDEXES_8(32), INDEXES_8(40), INDEXES_8(48), INDEXES_8(56)
+    >();
+}
+
+void constexpr_indexes() {
+// Following tests are known to fail on _MSC_VER == 1916.
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && (!defined(_MSC_VER) || _MSC_VER > 1916)
+    constexpr std::size_t string_index = small_set::index_of<std::string>();
+    static_assert(string_index == 2, "");
+
+    constexpr std::size_t short_index = small_set::index_of<short>();
+    static_assert(short_index == small_set::npos, "");
+
+    int handlers[small_set::size()] = {};
+    handlers[small_set::index_of<double>()] = 42;
+    BOOST_TEST_EQ(handlers[3], 42);
+#endif
+}
+
+int main() {
+    small_set_indexes();
+    empty_set();
+    big_set_indexes();
+    constexpr_indexes();
+
+    return boost::report_errors();
+}